@@ -0,0 +1,373 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+// Benchmarks end-to-end docking workflows on the headless frontend.
+// Everything goes through the real controllers: layouting, drag controller, drop indicators and
+// LayoutSaver. Only rendering is missing, so numbers reflect the cost of the docking logic itself.
+
+#include "headless/Platform.h"
+#include "headless/views/MainWindow.h"
+#include "headless/views/View.h"
+
+#include "kddockwidgets/Config.h"
+#include "kddockwidgets/KDDockWidgets.h"
+#include "kddockwidgets/LayoutSaver.h"
+#include "kddockwidgets/core/DockRegistry.h"
+#include "kddockwidgets/core/DockWidget.h"
+#include "kddockwidgets/core/DropArea.h"
+#include "kddockwidgets/core/DropIndicatorOverlay.h"
+#include "kddockwidgets/core/FloatingWindow.h"
+#include "kddockwidgets/core/MainWindow.h"
+#include "kddockwidgets/core/TitleBar.h"
+#include "kddockwidgets/core/ViewFactory.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+using namespace KDDockWidgets;
+
+namespace {
+
+headless::Platform *platform()
+{
+    return headless::Platform::platformHeadless();
+}
+
+/// Runs the pending delayed calls, like returning to the event loop would
+void processEvents()
+{
+    platform()->processEvents();
+}
+
+Core::DockWidget *createDockWidget(int index)
+{
+    auto dw = Config::self().viewFactory()->createDockWidget(QStringLiteral("dw-") + QString::number(index))->asDockWidgetController();
+    dw->setGuestView(platform()->createView(nullptr)->asWrapper());
+    return dw;
+}
+
+/// Enough for a busy application window, while still fitting it
+constexpr int NumDockWidgets = 16;
+
+struct Fixture
+{
+    explicit Fixture(int numDockWidgets)
+    {
+        static int count = 0;
+        mainWindowView = new headless::MainWindow(QStringLiteral("mw-") + QString::number(++count));
+        mainWindowView->setGeometry(Rect(100, 100, 1600, 900));
+        mainWindowView->show();
+
+        for (int i = 0; i < numDockWidgets; ++i)
+            dockWidgets.push_back(createDockWidget(i));
+    }
+
+    ~Fixture()
+    {
+        for (auto dw : dockWidgets)
+            delete dw;
+
+        delete mainWindowView;
+        processEvents();
+    }
+
+    Core::MainWindow *mainWindow() const
+    {
+        return mainWindowView->mainWindow();
+    }
+
+    headless::MainWindow *mainWindowView;
+    std::vector<Core::DockWidget *> dockWidgets;
+
+    Fixture(const Fixture &) = delete;
+    Fixture &operator=(const Fixture &) = delete;
+};
+
+/// Docks the dock widgets as four stacks, one on each side of the main window.
+/// Like a real application, the layout stays shallow and fits the window.
+void dockAll(Fixture &f)
+{
+    const Location sides[] = { Location_OnLeft, Location_OnTop, Location_OnRight, Location_OnBottom };
+    Core::DockWidget *lastOnSide[4] = {};
+    for (size_t i = 0; i < f.dockWidgets.size(); ++i) {
+        Core::DockWidget *dw = f.dockWidgets[i];
+        const int side = int(i % 4);
+        if (Core::DockWidget *relativeTo = lastOnSide[side]) {
+            const bool isColumn = sides[side] == Location_OnLeft || sides[side] == Location_OnRight;
+            f.mainWindow()->addDockWidget(dw, isColumn ? Location_OnBottom : Location_OnRight, relativeTo);
+        } else {
+            f.mainWindow()->addDockWidget(dw, sides[side]);
+        }
+        lastOnSide[side] = dw;
+    }
+    processEvents();
+}
+
+/// Drags the floating window by its title bar and drops it on the main window's @p location indicator
+void dragIntoMainWindow(Core::FloatingWindow *fw, Core::MainWindow *mainWindow, DropLocation location)
+{
+    Core::View *titleBar = fw->titleBar()->view();
+    Point pos = titleBar->mapToGlobal(Point(15, 15));
+    platform()->mousePress(pos);
+
+    // Move in small steps, so the drag starts and the window follows the mouse
+    const Point target = mainWindow->view()->mapToGlobal(mainWindow->view()->rect().center());
+    const int steps = 10;
+    const Point start = pos;
+    for (int i = 1; i <= steps; ++i) {
+        pos = start + Point((target.x() - start.x()) * i / steps, (target.y() - start.y()) * i / steps);
+        platform()->mouseMove(pos);
+        processEvents();
+    }
+
+    // The indicators are showing now
+    const Point dropPos = mainWindow->dropArea()->dropIndicatorOverlay()->posForIndicator(location);
+    platform()->mouseMove(dropPos);
+    processEvents();
+    platform()->mouseRelease(dropPos);
+    processEvents();
+}
+
+/// Accumulates the time spent in the measured sections of a scenario.
+/// Setting up and tearing down the fixtures isn't measured. Call report() once done.
+class Timing
+{
+public:
+    explicit Timing(const char *name)
+        : m_name(name)
+    {
+    }
+
+    void report() const
+    {
+        s_totalMs += m_ms;
+        std::printf("%-32s %8d ops %12.2f ms %10.4f ms/op\n", m_name, m_numOperations, m_ms,
+                    m_numOperations > 0 ? m_ms / m_numOperations : 0.0);
+        std::fflush(stdout);
+    }
+
+    void measure(int numOperations, const std::function<void()> &func)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const auto end = std::chrono::steady_clock::now();
+
+        m_ms += std::chrono::duration<double, std::milli>(end - start).count();
+        m_numOperations += numOperations;
+    }
+
+    static double s_totalMs;
+
+private:
+    const char *const m_name;
+    double m_ms = 0;
+    int m_numOperations = 0;
+
+    Timing(const Timing &) = delete;
+    Timing &operator=(const Timing &) = delete;
+};
+
+double Timing::s_totalMs = 0;
+
+void benchAddDockWidget(int iterations)
+{
+    Timing timing("addDockWidget");
+    for (int i = 0; i < iterations; ++i) {
+        Fixture f(NumDockWidgets);
+        timing.measure(NumDockWidgets, [&f] { dockAll(f); });
+    }
+
+    timing.report();
+}
+
+void benchAddDockWidgetAsTab(int iterations)
+{
+    Timing asTab("addDockWidgetAsTab");
+    Timing currentTab("setCurrentTab");
+    for (int i = 0; i < iterations; ++i) {
+        Fixture f(NumDockWidgets);
+        Core::DockWidget *first = f.dockWidgets.front();
+        f.mainWindow()->addDockWidget(first, Location_OnLeft);
+
+        asTab.measure(NumDockWidgets - 1, [&f, first] {
+            for (size_t j = 1; j < f.dockWidgets.size(); ++j)
+                first->addDockWidgetAsTab(f.dockWidgets[j]);
+            processEvents();
+        });
+
+        currentTab.measure(NumDockWidgets, [&f] {
+            for (auto dw : f.dockWidgets)
+                dw->setAsCurrentTab();
+            processEvents();
+        });
+    }
+
+    asTab.report();
+    currentTab.report();
+}
+
+void benchFloatAndRedock(int iterations)
+{
+    Timing floating("setFloating(true)");
+    Timing docked("setFloating(false)");
+    for (int i = 0; i < iterations; ++i) {
+        Fixture f(NumDockWidgets);
+        dockAll(f);
+
+        floating.measure(NumDockWidgets, [&f] {
+            for (auto dw : f.dockWidgets)
+                dw->setFloating(true);
+            processEvents();
+        });
+
+        docked.measure(NumDockWidgets, [&f] {
+            for (auto dw : f.dockWidgets)
+                dw->setFloating(false);
+            processEvents();
+        });
+    }
+
+    floating.report();
+    docked.report();
+}
+
+void benchCloseAndOpen(int iterations)
+{
+    Timing closing("close");
+    Timing opening("open (restores position)");
+    for (int i = 0; i < iterations; ++i) {
+        Fixture f(NumDockWidgets);
+        dockAll(f);
+
+        closing.measure(NumDockWidgets, [&f] {
+            for (auto dw : f.dockWidgets)
+                dw->view()->close();
+            processEvents();
+        });
+
+        opening.measure(NumDockWidgets, [&f] {
+            for (auto dw : f.dockWidgets)
+                dw->open();
+            processEvents();
+        });
+    }
+
+    closing.report();
+    opening.report();
+}
+
+void benchMouseDrag(int iterations)
+{
+    const DropLocation locations[] = { DropLocation_OutterLeft, DropLocation_OutterTop,
+                                       DropLocation_OutterRight, DropLocation_OutterBottom };
+
+    Timing timing("mouse drag and drop");
+    int numDocked = 0;
+    for (int i = 0; i < iterations; ++i) {
+        Fixture f(NumDockWidgets);
+        dockAll(f);
+
+        // Each dock widget is floated and then dragged back into the main window with the mouse
+        int j = 0;
+        for (auto dw : f.dockWidgets) {
+            dw->setFloating(true);
+            processEvents();
+            if (Core::FloatingWindow *fw = dw->floatingWindow()) {
+                timing.measure(1, [&] { dragIntoMainWindow(fw, f.mainWindow(), locations[j % 4]); });
+                if (!dw->isFloating())
+                    ++numDocked;
+            }
+            ++j;
+        }
+    }
+
+    timing.report();
+
+    if (numDocked != iterations * NumDockWidgets) {
+        std::fprintf(stderr, "Only %d out of %d drags docked into the main window\n", numDocked,
+                     iterations * NumDockWidgets);
+        std::exit(1);
+    }
+}
+
+void benchLayoutSaver(int iterations)
+{
+    Fixture f(NumDockWidgets);
+    dockAll(f);
+
+    // Some variety: a few tabs and a few floating windows
+    for (size_t i = 1; i < f.dockWidgets.size(); i += 5)
+        f.dockWidgets[i - 1]->addDockWidgetAsTab(f.dockWidgets[i]);
+    for (size_t i = 3; i < f.dockWidgets.size(); i += 7)
+        f.dockWidgets[i]->setFloating(true);
+    processEvents();
+
+    LayoutSaver saver;
+    QByteArray saved;
+    {
+        Timing timing("LayoutSaver::serializeLayout");
+        timing.measure(iterations, [&] {
+            for (int i = 0; i < iterations; ++i)
+                saved = saver.serializeLayout();
+        });
+        timing.report();
+    }
+
+    Timing timing("LayoutSaver::restoreLayout");
+    timing.measure(iterations, [&] {
+        for (int i = 0; i < iterations; ++i) {
+            if (!saver.restoreLayout(saved)) {
+                std::fprintf(stderr, "Failed to restore layout\n");
+                std::exit(1);
+            }
+            processEvents();
+        }
+    });
+    timing.report();
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 10;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = std::atoi(argv[++i]);
+        } else {
+            std::fprintf(stderr, "Usage: %s [--iterations N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (iterations < 1)
+        iterations = 1;
+
+    KDDockWidgets::initFrontend(KDDockWidgets::FrontendType::Headless);
+
+    std::printf("%d dock widgets, %d iterations per scenario\n\n", NumDockWidgets, iterations);
+
+    benchAddDockWidget(iterations);
+    benchAddDockWidgetAsTab(iterations);
+    benchFloatAndRedock(iterations);
+    benchCloseAndOpen(iterations);
+    benchMouseDrag(iterations);
+    benchLayoutSaver(iterations);
+
+    std::printf("\nTotal: %.2f ms\n", Timing::s_totalMs);
+
+    delete Core::Platform::instance();
+    return 0;
+}
@@ -77,6 +77,16 @@ public:
     bool m_dropIndicatorsInhibited = false;
     bool m_layoutSaverStrictMode = false;
     bool m_onlyProgrammaticDrag = false;
+    bool m_predictiveDropPreview = false;
+    int m_floatingWindowPoolSize = 0;
+    bool m_dragMotionCompression = false;
+    bool m_dragMotionCappedAtRefreshRate = false;
+    int m_dragHoverThreshold = 0;
+    int m_separatorPoolSize = 0;
+    int m_layoutTransitionDuration = 0;
+    bool m_layoutProfilingEnabled = false;
+    int m_deferredDeletionBudget = 0;
+    bool m_sharedClassicIndicatorWindow = false;
 };
 
 Config::Config()
@@ -441,4 +451,104 @@ bool Config::onlyProgrammaticDrag() const
     return d->m_onlyProgrammaticDrag;
 }
 
+void Config::setPredictiveDropPreview(bool enabled)
+{
+    d->m_predictiveDropPreview = enabled;
+}
+
+bool Config::predictiveDropPreview() const
+{
+    return d->m_predictiveDropPreview;
+}
+
+void Config::setFloatingWindowPoolSize(int size)
+{
+    d->m_floatingWindowPoolSize = size;
+}
+
+int Config::floatingWindowPoolSize() const
+{
+    return d->m_floatingWindowPoolSize;
+}
+
+void Config::setDragMotionCompression(bool enabled)
+{
+    d->m_dragMotionCompression = enabled;
+}
+
+bool Config::dragMotionCompression() const
+{
+    return d->m_dragMotionCompression;
+}
+
+void Config::setDragMotionCappedAtRefreshRate(bool capped)
+{
+    d->m_dragMotionCappedAtRefreshRate = capped;
+}
+
+bool Config::dragMotionCappedAtRefreshRate() const
+{
+    return d->m_dragMotionCappedAtRefreshRate;
+}
+
+void Config::setDragHoverThreshold(int threshold)
+{
+    d->m_dragHoverThreshold = threshold;
+}
+
+int Config::dragHoverThreshold() const
+{
+    return d->m_dragHoverThreshold;
+}
+
+void Config::setSeparatorPoolSize(int size)
+{
+    d->m_separatorPoolSize = size;
+}
+
+int Config::separatorPoolSize() const
+{
+    return d->m_separatorPoolSize;
+}
+
+void Config::setLayoutTransitionDuration(int ms)
+{
+    d->m_layoutTransitionDuration = ms;
+}
+
+int Config::layoutTransitionDuration() const
+{
+    return d->m_layoutTransitionDuration;
+}
+
+void Config::setLayoutProfilingEnabled(bool enabled)
+{
+    d->m_layoutProfilingEnabled = enabled;
+}
+
+bool Config::layoutProfilingEnabled() const
+{
+    return d->m_layoutProfilingEnabled;
+}
+
+void Config::setDeferredDeletionBudget(int ms)
+{
+    d->m_deferredDeletionBudget = ms;
+}
+
+int Config::deferredDeletionBudget() const
+{
+    return d->m_deferredDeletionBudget;
+}
+
+void Config::setSharedClassicIndicatorWindow(bool shared)
+{
+    d->m_sharedClassicIndicatorWindow = shared;
+}
+
+bool Config::sharedClassicIndicatorWindow() const
+{
+    return d->m_sharedClassicIndicatorWindow;
+}
+
 }
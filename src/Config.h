@@ -174,7 +174,7 @@ public:
         InternalFlag_NoDeleteLaterWorkaround = 128, ///< Disables workaround for QTBUG-83030. Will be the default since Qt 6.7
                                                     /// While the workaround works, it will cause memory leaks at shutdown,
         /// This flag allows to disable the workaround if you think you don't have the complex setup reported in QTBUG-83030
-        InternalFlag_DeleteSeparatorsLater = 256 ///< Uses deleteLater() when disposing of separators
+        InternalFlag_DeleteSeparatorsLater = 256 ///< Uses Controller::destroyLater() when disposing of separators
     };
     Q_DECLARE_FLAGS(InternalFlags, InternalFlag)
 
@@ -411,6 +411,75 @@ public:
     void setOnlyProgrammaticDrag(bool);
     bool onlyProgrammaticDrag() const;
 
+    /// When enabled, hovering a drop indicator simulates the drop in a headless copy of the
+    /// target layout and caches the result per drop location, so the rubber band isn't
+    /// recalculated on every mouse move. The actual drop then resizes each dock widget only once,
+    /// instead of once per relayout step.
+    /// Default is false.
+    void setPredictiveDropPreview(bool);
+    bool predictiveDropPreview() const;
+
+    /// Sets how many empty floating windows are kept hidden for reuse, instead of being deleted.
+    /// Detaching a dock widget then reuses one of them instead of creating a new native window.
+    /// Only windows with the same parent and window flags are reused.
+    /// Default is 0, which disables pooling.
+    void setFloatingWindowPoolSize(int);
+    int floatingWindowPoolSize() const;
+
+    /// When enabled, mouse moves received while dragging a floating window are compressed: only the
+    /// latest pending position is processed, once per event loop iteration. Useful with high
+    /// polling rate mice. A mouse release always processes the final position first.
+    /// Default is false.
+    void setDragMotionCompression(bool);
+    bool dragMotionCompression() const;
+
+    /// When enabled together with setDragMotionCompression(), compressed mouse moves are processed
+    /// at most once per display frame, as reported by Platform::screenRefreshRateFor().
+    /// Default is false.
+    void setDragMotionCappedAtRefreshRate(bool);
+    bool dragMotionCappedAtRefreshRate() const;
+
+    /// While dragging, mouse moves shorter than @p threshold pixels (manhattan length) which stay
+    /// over the same drop area, group and drop location don't redo the hover.
+    /// Default is 0, every move hovers.
+    void setDragHoverThreshold(int threshold);
+    int dragHoverThreshold() const;
+
+    /// Sets how many unused separators each layout keeps hidden for reuse, instead of deleting them.
+    /// Docking, undocking and restoring then reuse separators instead of creating new views.
+    /// Default is 0, which disables pooling.
+    void setSeparatorPoolSize(int);
+    int separatorPoolSize() const;
+
+    /// Sets how long, in ms, docked groups take to move to their new geometry when the layout changes,
+    /// for example when docking, closing or restoring a dock widget.
+    /// The final geometries are computed once and the groups are animated towards them, one frame per
+    /// display refresh. Frames are skipped if they run late. Floating and MDI groups aren't animated.
+    /// Default is 0, which disables transitions.
+    void setLayoutTransitionDuration(int ms);
+    int layoutTransitionDuration() const;
+
+    /// When enabled, each layout records the wall time, items visited, guest geometry updates and
+    /// signal emissions of its insert, remove, resize, separator move, restore and simplify operations.
+    /// See Core::Layout::statistics() and DockRegistry::layoutStatistics().
+    /// Default is false.
+    void setLayoutProfilingEnabled(bool);
+    bool layoutProfilingEnabled() const;
+
+    /// Controllers scheduled for deletion, like closed groups and floating windows, are deleted in
+    /// batches. Sets how long, in ms, a batch may take. The remaining ones are deleted on the next frame.
+    /// Useful when closing layouts with hundreds of groups. Default is 0, which deletes everything at once.
+    /// Doesn't apply when QObject::deleteLater() is used, see InternalFlag_NoDeleteLaterWorkaround.
+    void setDeferredDeletionBudget(int ms);
+    int deferredDeletionBudget() const;
+
+    /// When enabled, all drop areas share a single classic drop indicator window, created on the
+    /// first hover, instead of each drop area creating its own.
+    /// Frontends whose indicator window isn't a top-level, like on Wayland, keep one per drop area.
+    /// Only applies to drop areas created after this call. Default is false.
+    void setSharedClassicIndicatorWindow(bool);
+    bool sharedClassicIndicatorWindow() const;
+
 private:
     KDDW_DELETE_COPY_CTOR(Config)
     Config();
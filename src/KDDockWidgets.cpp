@@ -26,6 +26,10 @@
 #include "flutter/Platform.h"
 #endif
 
+#ifdef KDDW_FRONTEND_HEADLESS
+#include "headless/Platform.h"
+#endif
+
 using namespace KDDockWidgets;
 
 void KDDockWidgets::initFrontend(FrontendType type)
@@ -47,6 +51,11 @@ void KDDockWidgets::initFrontend(FrontendType type)
     case FrontendType::Flutter:
         // Nothing to do, called from Dart
         break;
+    case FrontendType::Headless:
+#ifdef KDDW_FRONTEND_HEADLESS
+        new headless::Platform();
+#endif
+        break;
     }
 }
 
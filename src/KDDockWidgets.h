@@ -23,6 +23,8 @@
 
 #include "QtCompat_p.h"
 
+#include <cstdint>
+
 #ifdef KDDW_FRONTEND_QT
 #include "Qt5Qt6Compat_p.h"
 
@@ -123,6 +125,7 @@ enum class FrontendType {
     QtWidgets = 1,
     QtQuick,
     Flutter,
+    Headless, ///< In-memory views without a display server, see src/headless/
 };
 Q_ENUM_NS(FrontendType)
 
@@ -382,6 +385,100 @@ enum class CloseReason {
     OverlayCollapse = 8 /// Dock widget went from overlay to sidebar (auto-hide/sidebar/pin-unpin functionality)
 };
 
+/// @brief How MDILayout::arrange() positions the MDI windows
+enum class MDIArrangement {
+    Tile = 0, /// A grid filling the whole area
+    Cascade, /// Overlapping, each window offset from the previous one
+    Masonry /// Columns of equal width, each window keeps its aspect ratio
+};
+Q_ENUM_NS(MDIArrangement)
+
+/// @brief The kinds of layout operation whose cost LayoutStatistics records
+/// @sa Config::setLayoutProfilingEnabled()
+enum class LayoutOperation {
+    Insert = 0, /// Docking a group into the layout
+    Remove, /// Closing or undocking a group
+    Resize, /// Resizing the layout, or laying it out equally
+    SeparatorMove, /// Dragging a separator, or giving its neighbours equal sizes
+    Restore, /// Showing a closed group again, or restoring a saved layout
+    Simplify, /// Merging nested containers which became redundant
+    Count /// @internal
+};
+
+/// @brief The accumulated cost of one kind of layout operation
+struct LayoutOperationStats
+{
+    /// How many operations ran. Nested operations of the same kind count as one.
+    int count = 0;
+    /// Wall time spent, in nanoseconds. Nested operations of another kind are accounted to their own kind.
+    int64_t wallTimeNs = 0;
+    /// How many times an item's geometry was assigned
+    int64_t itemsVisited = 0;
+    /// How many times a guest, usually a Group, got a new geometry
+    int64_t guestGeometryUpdates = 0;
+    /// How many layout signals were emitted
+    int64_t signalEmissions = 0;
+
+    LayoutOperationStats &operator+=(const LayoutOperationStats &other)
+    {
+        count += other.count;
+        wallTimeNs += other.wallTimeNs;
+        itemsVisited += other.itemsVisited;
+        guestGeometryUpdates += other.guestGeometryUpdates;
+        signalEmissions += other.signalEmissions;
+        return *this;
+    }
+};
+
+/// @brief The cost of each kind of operation, for a single layout
+struct LayoutStatistics
+{
+    LayoutOperationStats operations[int(LayoutOperation::Count)];
+
+    const LayoutOperationStats &operator[](LayoutOperation operation) const
+    {
+        return operations[int(operation)];
+    }
+
+    LayoutOperationStats &operator[](LayoutOperation operation)
+    {
+        return operations[int(operation)];
+    }
+
+    /// Returns the sum of all operations
+    LayoutOperationStats total() const
+    {
+        LayoutOperationStats result;
+        for (const LayoutOperationStats &stats : operations)
+            result += stats;
+        return result;
+    }
+};
+
+/// @brief Affinity names, interned so they can be matched with a bitwise AND
+/// @sa DockRegistry::internAffinities()
+struct AffinitySet
+{
+    /// The bit shared by every name after the 63rd distinct one. Names sharing it are compared as strings.
+    static constexpr uint64_t OverflowBit = uint64_t(1) << 63;
+
+    Vector<QString> names;
+
+    /// One bit per distinct name
+    uint64_t mask = 0;
+};
+
+/// @brief The areas KDDW's log output is split into
+/// @sa setLogLevel()
+enum class LogCategory {
+    General = 0, /// Anything not covered by the categories below
+    Layouting, /// Separators, item sizes and constraints
+    Drag, /// Drag and drop, drop areas under the cursor
+    Restore, /// Saving and restoring layouts
+    Focus, /// Focus scopes
+    Count /// @internal
+};
+
 /// @brief Initializes the desired frontend
 /// This function should be called before using any docking.
 /// Note that if you only built one frontend (by specifying for example -DKDDockWidgets_FRONTENDS=qtwidgets)
@@ -392,6 +489,13 @@ void DOCKS_EXPORT initFrontend(FrontendType);
 /// You can pass this name to spdlog::get() and change log level
 DOCKS_EXPORT const char *spdlogLoggerName();
 
+/// @brief Sets the minimum level @p category logs at
+/// @p level is a spdlog::level::level_enum, for example spdlog::level::debug.
+/// This filters on top of the logger's level, so to see debug output for a single area, lower the
+/// logger's level to debug and raise the other categories to info.
+/// By default categories let everything through. Does nothing if KDDW was built without spdlog.
+DOCKS_EXPORT void setLogLevel(LogCategory category, int level);
+
 #ifdef KDDW_FRONTEND_QTWIDGETS
 
 /// @brief Returns the first ancestor widget of the specified type T for the specified
@@ -27,18 +27,23 @@
 
 #include "core/DockRegistry.h"
 #include "core/Platform.h"
+#include "core/Platform_p.h"
 #include "core/Layout.h"
 #include "core/Group.h"
 #include "core/FloatingWindow.h"
 #include "core/DockWidget.h"
 #include "core/DockWidget_p.h"
 #include "core/MainWindow.h"
+#include "core/SideBar.h"
+#include "core/TitleBar.h"
 #include "core/nlohmann_helpers_p.h"
 #include "core/layouting/Item_p.h"
 
 #include <iostream>
 #include <fstream>
 #include <cmath>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 /**
@@ -416,6 +421,9 @@ QByteArray LayoutSaver::serializeLayout() const
         return {};
     }
 
+    // Save where groups are going, not where they are mid-animation
+    d->m_dockRegistry->finishLayoutTransitions();
+
     LayoutSaver::Layout layout;
 
     // Just a simplification. One less type of windows to handle.
@@ -460,6 +468,170 @@ QByteArray LayoutSaver::serializeLayout() const
     return layout.toJson();
 }
 
+namespace {
+
+/// Writes the buffer returned by LayoutSaver::serializeSnapshot()
+class SnapshotWriter
+{
+public:
+    static constexpr int32_t Magic = 0x4B444453; // 'KDDS'
+    static constexpr int HeaderSize = 4;
+    static constexpr int NodeSize = 12;
+
+    int addNode(LayoutSaver::SnapshotNodeKind kind, int parentIndex, Rect geometry, int flags,
+                int tabIndex, const QString &name, const QString &title)
+    {
+        const int32_t values[NodeSize] = { int32_t(kind),
+                                           parentIndex,
+                                           geometry.x(),
+                                           geometry.y(),
+                                           geometry.width(),
+                                           geometry.height(),
+                                           flags,
+                                           tabIndex,
+                                           addString(name),
+                                           int32_t(m_lastStringSize),
+                                           addString(title),
+                                           int32_t(m_lastStringSize) };
+
+        m_nodes.insert(m_nodes.end(), std::begin(values), std::end(values));
+        return m_numNodes++;
+    }
+
+    std::string toStdString() const
+    {
+        const int32_t header[HeaderSize] = { Magic, LayoutSaver::snapshotVersion(), m_numNodes,
+                                             int32_t(m_strings.size()) };
+
+        std::string result;
+        result.reserve(sizeof(header) + m_nodes.size() * sizeof(int32_t) + m_strings.size());
+        result.append(reinterpret_cast<const char *>(header), sizeof(header));
+        result.append(reinterpret_cast<const char *>(m_nodes.data()), m_nodes.size() * sizeof(int32_t));
+        result.append(m_strings);
+
+        return result;
+    }
+
+private:
+    int32_t addString(const QString &str)
+    {
+        const std::string utf8 = str.toStdString();
+        const auto offset = int32_t(m_strings.size());
+        m_strings.append(utf8);
+        m_lastStringSize = utf8.size();
+        return offset;
+    }
+
+    std::vector<int32_t> m_nodes;
+    std::string m_strings;
+    size_t m_lastStringSize = 0;
+    int m_numNodes = 0;
+};
+
+int snapshotFlags(const Core::View *view)
+{
+    return view->isVisible() ? LayoutSaver::SnapshotNodeFlag_Visible : LayoutSaver::SnapshotNodeFlag_None;
+}
+
+void addSnapshotGroups(SnapshotWriter &writer, const Vector<Core::Group *> &groups, int parentIndex,
+                       int extraFlags, std::unordered_set<const Core::DockWidget *> &visited)
+{
+    for (Core::Group *group : groups) {
+        const int groupIndex = writer.addNode(LayoutSaver::SnapshotNodeKind::Group, parentIndex,
+                                              group->view()->geometry(),
+                                              snapshotFlags(group->view()) | extraFlags, -1, {},
+                                              group->title());
+
+        const int currentIndex = group->currentIndex();
+        const auto dockWidgets = group->dockWidgets();
+        for (int i = 0; i < dockWidgets.size(); ++i) {
+            Core::DockWidget *dw = dockWidgets.at(i);
+            visited.insert(dw);
+
+            int flags = snapshotFlags(dw->view()) | extraFlags;
+            if (i == currentIndex)
+                flags |= LayoutSaver::SnapshotNodeFlag_CurrentTab;
+
+            writer.addNode(LayoutSaver::SnapshotNodeKind::DockWidget, groupIndex,
+                           dw->view()->geometry(), flags, i, dw->uniqueName(), dw->title());
+        }
+    }
+}
+
+}
+
+int LayoutSaver::snapshotVersion()
+{
+    return 1;
+}
+
+QByteArray LayoutSaver::serializeSnapshot() const
+{
+    return QByteArray::fromStdString(d->createSnapshot());
+}
+
+int LayoutSaver::updateSnapshot()
+{
+    d->m_snapshot = d->createSnapshot();
+    return int(d->m_snapshot.size());
+}
+
+void *LayoutSaver::snapshotBuffer()
+{
+    return d->m_snapshot.data();
+}
+
+std::string LayoutSaver::Private::createSnapshot() const
+{
+    SnapshotWriter writer;
+    std::unordered_set<const Core::DockWidget *> visited;
+    std::unordered_map<const Core::MainWindow *, int> mainWindowIndexes;
+
+    for (auto mainWindow : m_dockRegistry->mainwindows()) {
+        if (!matchesAffinity(mainWindow->affinities()))
+            continue;
+
+        const int index = writer.addNode(LayoutSaver::SnapshotNodeKind::MainWindow, -1, mainWindow->view()->geometry(),
+                                         snapshotFlags(mainWindow->view()), -1,
+                                         mainWindow->uniqueName(), {});
+        mainWindowIndexes[mainWindow] = index;
+        addSnapshotGroups(writer, mainWindow->layout()->groups(), index, LayoutSaver::SnapshotNodeFlag_None, visited);
+    }
+
+    const auto floatingWindows =
+        m_dockRegistry->floatingWindows(/*includeBeingDeleted=*/false, /*honourSkipped=*/false);
+    for (Core::FloatingWindow *floatingWindow : floatingWindows) {
+        if (!matchesAffinity(floatingWindow->affinities()))
+            continue;
+
+        const int index = writer.addNode(LayoutSaver::SnapshotNodeKind::FloatingWindow, -1,
+                                         floatingWindow->view()->geometry(),
+                                         snapshotFlags(floatingWindow->view()) | LayoutSaver::SnapshotNodeFlag_Floating,
+                                         -1, {}, floatingWindow->titleBar()->title());
+        addSnapshotGroups(writer, floatingWindow->layout()->groups(), index, LayoutSaver::SnapshotNodeFlag_Floating, visited);
+    }
+
+    // Closed and auto-hidden dock widgets aren't in any group
+    for (Core::DockWidget *dw : m_dockRegistry->dockwidgets()) {
+        if (visited.count(dw) || !matchesAffinity(dw->affinities()))
+            continue;
+
+        int parentIndex = -1;
+        int flags = snapshotFlags(dw->view());
+        if (Core::SideBar *sideBar = m_dockRegistry->sideBarForDockWidget(dw)) {
+            flags |= LayoutSaver::SnapshotNodeFlag_InSideBar;
+            auto it = mainWindowIndexes.find(sideBar->mainWindow());
+            if (it != mainWindowIndexes.end())
+                parentIndex = it->second;
+        }
+
+        writer.addNode(LayoutSaver::SnapshotNodeKind::DockWidget, parentIndex, dw->view()->geometry(), flags, -1,
+                       dw->uniqueName(), dw->title());
+    }
+
+    return writer.toStdString();
+}
+
 bool LayoutSaver::restoreLayout(const QByteArray &data)
 {
     LayoutSaver::DockWidget::s_dockWidgets.clear();
@@ -467,6 +639,8 @@ bool LayoutSaver::restoreLayout(const QByteArray &data)
     if (data.isEmpty())
         return true;
 
+    d->m_dockRegistry->finishLayoutTransitions();
+
     struct GroupCleanup
     {
         explicit GroupCleanup(LayoutSaver *saver)
@@ -582,7 +756,7 @@ bool LayoutSaver::restoreLayout(const QByteArray &data)
                 dw->uniqueName, DockRegistry::DockByNameFlag::ConsultRemapping)) {
             dockWidget->d->lastPosition()->deserialize(dw->lastPosition);
         } else {
-            KDDW_INFO("Couldn't find dock widget {}", dw->uniqueName);
+            KDDW_CINFO(Restore, "Couldn't find dock widget {}", dw->uniqueName);
             auto pos = std::make_shared<KDDockWidgets::Position>();
             pos->deserialize(dw->lastPosition);
             LayoutSaver::Private::s_unrestoredPositions[dw->uniqueName] = pos;
@@ -722,6 +896,7 @@ void LayoutSaver::Private::deleteEmptyGroups() const
     // After a restore it can happen that some DockWidgets didn't exist, so weren't restored.
     // Delete their group now.
 
+    Vector<Core::Controller *> emptyGroups;
     const auto groups = m_dockRegistry->groups();
     for (auto group : groups) {
         if (!group->beingDeletedLater() && group->isEmpty() && !group->isCentralGroup()) {
@@ -731,9 +906,12 @@ void LayoutSaver::Private::deleteEmptyGroups() const
                 // This doesn't happen. But the warning will make the tests fail if there's a regression.
                 KDDW_ERROR("Expected item for group");
             }
-            delete group;
+            emptyGroups.push_back(group);
         }
     }
+
+    // Deleted together, so their layouts only update once
+    Core::Platform::instance()->d->m_deletionService.destroyNow(emptyGroups);
 }
 
 bool LayoutSaver::restoreInProgress()
@@ -83,6 +83,56 @@ public:
      */
     QByteArray serializeLayout() const;
 
+    /// Node kinds in serializeSnapshot()
+    enum class SnapshotNodeKind {
+        MainWindow = 0,
+        FloatingWindow = 1,
+        Group = 2,
+        DockWidget = 3
+    };
+
+    /// Node flags in serializeSnapshot()
+    enum SnapshotNodeFlag {
+        SnapshotNodeFlag_None = 0,
+        SnapshotNodeFlag_Visible = 1,
+        SnapshotNodeFlag_Floating = 2,
+        SnapshotNodeFlag_CurrentTab = 4,
+        SnapshotNodeFlag_InSideBar = 8
+    };
+
+    /// Version of the format written by serializeSnapshot(). Bumped on incompatible changes.
+    static int snapshotVersion();
+
+    /**
+     * @brief Returns a compact binary snapshot of the current dock state
+     *
+     * Meant for consumers that inspect the state often, like UI layers and automation going
+     * through the Dart or Python bindings, where each call crosses a language boundary.
+     * Unlike serializeLayout() the snapshot can't be restored, but it's much cheaper to produce
+     * and to diff.
+     *
+     * All integers are native-endian int32. The buffer starts with a 4 integer header:
+     * magic ('KDDS', 0x4B444453), snapshotVersion(), node count and string table size.
+     * Then, one 12 integer record per node, with parents always before their children:
+     * kind (SnapshotNodeKind), parent node index or -1, x, y, width, height,
+     * flags (SnapshotNodeFlag), tab index or -1, name offset, name size, title offset, title size.
+     * Then the string table, with UTF-8 names and titles. Offsets are relative to its start.
+     *
+     * Nodes are main windows, floating windows, their groups and the groups' dock widgets.
+     * Closed dock widgets are also included, without parent. Dock widgets in a side bar have the
+     * main window as parent. Affinity names are honoured, like in serializeLayout().
+     */
+    QByteArray serializeSnapshot() const;
+
+    /// Like serializeSnapshot(), but keeps the snapshot in a buffer owned by this LayoutSaver
+    /// For the Dart bindings, which read it in place through snapshotBuffer().
+    /// Returns the snapshot's size in bytes.
+    int updateSnapshot();
+
+    /// Returns the buffer filled by updateSnapshot()
+    /// Valid until the next updateSnapshot() or until this LayoutSaver is destroyed.
+    void *snapshotBuffer();
+
     /**
      * @brief restores the layout from a byte array
      * All MainWindows and DockWidgets should have been created before calling
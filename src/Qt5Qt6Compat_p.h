@@ -38,6 +38,11 @@ inline Point eventGlobalPos(MouseEvent *ev)
     return ev->globalPosition().toPoint();
 }
 
+inline Point eventPos(MouseEvent *ev)
+{
+    return ev->position().toPoint();
+}
+
 inline Point eventPos(HoverEvent *ev)
 {
     return ev->position().toPoint();
@@ -66,6 +71,11 @@ inline Point eventGlobalPos(MouseEvent *ev)
     return ev->globalPos();
 }
 
+inline Point eventPos(MouseEvent *ev)
+{
+    return ev->pos();
+}
+
 #endif
 
 }
@@ -12,7 +12,7 @@
 #include "Controller.h"
 #include "Controller_p.h"
 #include "Platform.h"
-#include "DelayedCall_p.h"
+#include "Platform_p.h"
 #include "View.h"
 #include "Config.h"
 #include "View_p.h"
@@ -157,8 +157,8 @@ void Controller::destroyLater()
     }
 #endif
 
-    // Path for Flutter and QTBUG-83030:
-    Platform::instance()->runDelayed(0, new DelayedDelete(this));
+    // Path for Flutter and QTBUG-83030. Batched with the other deferred deletions.
+    Platform::instance()->d->m_deletionService.schedule(this);
 }
 
 Controller::Private *Controller::dptr() const
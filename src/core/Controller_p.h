@@ -38,6 +38,9 @@ public:
 
     View *const m_view;
     const ViewType m_type;
+
+    /// Set once DeletionService has it in its pending list
+    bool m_scheduledForDeletion = false;
 };
 
 }
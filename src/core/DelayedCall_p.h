@@ -17,7 +17,6 @@
 namespace KDDockWidgets::Core {
 
 class DockWidget;
-class Controller;
 
 class DelayedCall
 {
@@ -29,19 +28,6 @@ public:
     KDDW_DELETE_COPY_CTOR(DelayedCall)
 };
 
-class DelayedDelete : public DelayedCall
-{
-public:
-    explicit DelayedDelete(Controller *);
-    ~DelayedDelete() override;
-
-    void call() override;
-
-    KDDW_DELETE_COPY_CTOR(DelayedDelete)
-private:
-    ObjectGuard<Controller> m_object;
-};
-
 class DelayedEmitFocusChanged : public DelayedCall
 {
 public:
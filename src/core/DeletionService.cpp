@@ -0,0 +1,185 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "DeletionService_p.h"
+#include "DelayedCall_p.h"
+#include "DragController_p.h"
+#include "Platform_p.h"
+#include "Config.h"
+#include "Controller.h"
+#include "Controller_p.h"
+#include "Group.h"
+#include "View.h"
+#include "core/Utils_p.h"
+#include "core/layouting/Item_p.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::Core;
+
+namespace {
+
+/// @brief Runs DeletionService::processPending()
+class DelayedProcessDeletions : public DelayedCall
+{
+public:
+    void call() override
+    {
+        // The platform might be gone already, its pending deletions are then dropped
+        if (auto platform = Platform::instance())
+            platform->d->m_deletionService.processPending();
+    }
+};
+
+/// Returns how many views are above @p controller's, so children can be deleted first
+int depth(Controller *controller)
+{
+    int result = 0;
+    if (View *view = controller->view()) {
+        for (auto parent = view->parentView(); parent; parent = parent->parentView())
+            ++result;
+    }
+
+    return result;
+}
+
+}
+
+void DeletionService::schedule(Controller *controller)
+{
+    if (!controller || isScheduled(controller))
+        return;
+
+    controller->dptr()->m_scheduledForDeletion = true;
+    m_pending.push_back(controller);
+    if (!m_batchScheduled)
+        scheduleBatch(0);
+}
+
+void DeletionService::destroyNow(const Vector<Controller *> &controllers)
+{
+    ControllerList list;
+    list.reserve(size_t(controllers.size()));
+    for (Controller *controller : controllers)
+        list.push_back(controller);
+
+    destroy(list, /*withBudget=*/false);
+}
+
+bool DeletionService::isScheduled(const Controller *controller) const
+{
+    // A flag instead of searching m_pending, so scheduling n controllers isn't quadratic
+    return controller && controller->dptr()->m_scheduledForDeletion;
+}
+
+int DeletionService::numPending() const
+{
+    return int(std::count_if(m_pending.cbegin(), m_pending.cend(), [](const ObjectGuard<Controller> &pending) {
+        return !pending.isNull();
+    }));
+}
+
+void DeletionService::processPending()
+{
+    m_batchScheduled = false;
+
+    if (isWayland() && DragController::instance()->isInQDrag()) {
+        // Workaround QTBUG-115527. FloatingWindow must be deleted after QDrag::exec() ends.
+        scheduleBatch(200);
+        return;
+    }
+
+    // Controllers scheduled while deleting go into the next batch
+    ControllerList batch;
+    batch.swap(m_pending);
+
+    ControllerList remaining = destroy(batch, /*withBudget=*/true);
+    if (remaining.empty())
+        return;
+
+    // Out of budget, continue on the next frame. Keep them ahead of anything scheduled meanwhile.
+    for (const ObjectGuard<Controller> &controller : m_pending)
+        remaining.push_back(controller.data());
+    m_pending.swap(remaining);
+
+    const double refreshRate = Platform::instance()->screenRefreshRateFor(nullptr);
+    scheduleBatch(refreshRate > 0 ? int(std::ceil(1000.0 / refreshRate)) : 16);
+}
+
+void DeletionService::scheduleBatch(int ms)
+{
+    m_batchScheduled = true;
+    Platform::instance()->runDelayed(ms, new DelayedProcessDeletions());
+}
+
+DeletionService::ControllerList DeletionService::destroy(const ControllerList &controllers, bool withBudget)
+{
+    // Deepest first, in the order they were scheduled otherwise
+    std::vector<std::pair<int, size_t>> order;
+    order.reserve(controllers.size());
+    for (size_t i = 0; i < controllers.size(); ++i) {
+        if (Controller *controller = controllers[i])
+            order.push_back({ -depth(controller), i });
+    }
+    std::sort(order.begin(), order.end());
+
+    // The layouts losing a group don't resize their other groups until the batch is done
+    std::vector<ObjectGuard<ItemBoxContainer>> suspendedLayouts;
+    for (const auto &entry : order) {
+        auto group = object_cast<Group *>(controllers[entry.second].data());
+        Item *item = group ? group->layoutItem() : nullptr;
+        ItemBoxContainer *root = item ? item->root() : nullptr;
+        if (!root)
+            continue;
+
+        const bool alreadySuspended = std::any_of(suspendedLayouts.cbegin(), suspendedLayouts.cend(), [root](const ObjectGuard<ItemBoxContainer> &suspended) {
+            return suspended.data() == root;
+        });
+
+        if (!alreadySuspended) {
+            root->suspendGuestGeometryUpdates();
+            suspendedLayouts.push_back(root);
+        }
+    }
+
+    ControllerList remaining;
+    {
+        CoalescedGeometryChanges coalesced;
+
+        const int budget = withBudget ? Config::self().deferredDeletionBudget() : 0;
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < order.size(); ++i) {
+            if (budget > 0 && i > 0
+                && std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(budget)) {
+                for (size_t j = i; j < order.size(); ++j) {
+                    if (Controller *controller = controllers[order[j].second])
+                        remaining.push_back(controller);
+                }
+                break;
+            }
+
+            // Might have been deleted meanwhile, along with its parent
+            if (Controller *controller = controllers[order[i].second])
+                delete controller;
+        }
+    }
+
+    for (const ObjectGuard<ItemBoxContainer> &root : suspendedLayouts) {
+        if (root)
+            root->resumeGuestGeometryUpdates();
+    }
+
+    return remaining;
+}
@@ -0,0 +1,66 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "KDDockWidgets.h"
+#include "ObjectGuard_p.h"
+
+#include <vector>
+
+namespace KDDockWidgets::Core {
+
+class Controller;
+
+/// @brief Deletes the controllers scheduled with Controller::destroyLater(), in batches
+///
+/// Instead of one delayed call per controller, a single delayed call deletes everything scheduled
+/// meanwhile. Children are deleted before their parents, with geometry changes coalesced and the
+/// affected layouts not updating their guests until the batch is done.
+/// If Config::deferredDeletionBudget() is set, a batch stops once it's spent and the remaining
+/// controllers are deleted on the next frame.
+/// Owned by Platform, views are deleted by their controllers.
+class DOCKS_EXPORT_FOR_UNIT_TESTS DeletionService
+{
+public:
+    DeletionService() = default;
+
+    /// @brief Schedules @p controller for deletion. Scheduling it again does nothing.
+    void schedule(Controller *controller);
+
+    /// @brief Deletes @p controllers now, as a single batch, ignoring the budget
+    void destroyNow(const Vector<Controller *> &controllers);
+
+    /// @brief Returns whether @p controller is waiting for deletion
+    bool isScheduled(const Controller *controller) const;
+
+    /// @brief Returns how many controllers are waiting for deletion
+    int numPending() const;
+
+    /// @brief Deletes the pending controllers. Called by the delayed call schedule() posts.
+    void processPending();
+
+private:
+    using ControllerList = std::vector<ObjectGuard<Controller>>;
+
+    void scheduleBatch(int ms);
+
+    /// Deletes @p controllers, children first. Stops once the budget is spent, if @p withBudget.
+    /// Returns the controllers which weren't deleted yet.
+    ControllerList destroy(const ControllerList &controllers, bool withBudget);
+
+    ControllerList m_pending;
+    bool m_batchScheduled = false;
+
+    KDDW_DELETE_COPY_CTOR(DeletionService)
+};
+
+}
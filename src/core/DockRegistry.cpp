@@ -25,16 +25,19 @@
 #include "core/ObjectGuard_p.h"
 #include "core/views/MainWindowViewInterface.h"
 #include "core/FloatingWindow.h"
+#include "core/FloatingWindow_p.h"
+#include "core/ScopedValueRollback_p.h"
 #include "core/SideBar.h"
 #include "core/MainWindow.h"
 #include "core/DockWidget.h"
 #include "core/DropArea.h"
+#include "core/MDILayout.h"
 #include "core/Platform.h"
 #include "core/Window_p.h"
 
 #include "kdbindings/signal.h"
 
-#include <set>
+#include <unordered_map>
 #include <utility>
 
 using namespace KDDockWidgets;
@@ -58,6 +61,44 @@ private:
 
 }
 
+namespace {
+
+/// Adds @p object to @p index, counting it as a conflict if its name is empty or taken
+template<typename T>
+void addToNameIndex(std::unordered_map<QString, Vector<T *>> &index, const QString &name, T *object,
+                    int &numConflicts)
+{
+    Vector<T *> &objects = index[name];
+    if (name.isEmpty() || !objects.isEmpty())
+        ++numConflicts;
+
+    objects.push_back(object);
+}
+
+template<typename T>
+void removeFromNameIndex(std::unordered_map<QString, Vector<T *>> &index, const QString &name, T *object,
+                         int &numConflicts)
+{
+    auto it = index.find(name);
+    if (it == index.end() || !it->second.removeOne(object))
+        return;
+
+    if (name.isEmpty() || !it->second.isEmpty())
+        --numConflicts;
+
+    if (it->second.isEmpty())
+        index.erase(it);
+}
+
+template<typename T>
+T *firstInNameIndex(const std::unordered_map<QString, Vector<T *>> &index, const QString &name)
+{
+    auto it = index.find(name);
+    return it == index.cend() ? nullptr : it->second.constFirst();
+}
+
+}
+
 DockRegistry::DockRegistry(Core::Object *parent)
     : Core::Object(parent)
     , d(new Private())
@@ -65,15 +106,19 @@ DockRegistry::DockRegistry(Core::Object *parent)
 {
     Platform::instance()->installGlobalEventFilter(this);
 
-    d->m_connection = Platform::instance()->d->focusedViewChanged.connect(
-        &DockRegistry::onFocusedViewChanged, this);
+    Platform::instance()->d->m_focusRouter.setDockRegistry(this);
+
+    d->m_windowActivatedConnection = Platform::instance()->d->windowActivated.connect([this](std::shared_ptr<View> rootView) {
+        if (auto fw = rootView->asFloatingWindowController())
+            d->m_floatingWindowZOrder.raise(fw);
+    });
 }
 
 DockRegistry::~DockRegistry()
 {
     delete m_sideBarGroupings;
     Platform::instance()->removeGlobalEventFilter(this);
-    d->m_connection.disconnect();
+    Platform::instance()->d->m_focusRouter.setDockRegistry(nullptr);
     delete d;
 }
 
@@ -82,33 +127,34 @@ void DockRegistry::maybeDelete()
     // We delete the singleton just to make LSAN happy.
     // We could also simply ask the user do call something like KDDockWidgets::deinit() in the future,
     // Also, please don't change this to be deleted at static dtor time with Q_GLOBAL_STATIC.
-    if (isEmpty() && d->m_numLayoutSavers == 0 && m_groups.isEmpty())
+    if (d->m_drainingFloatingWindowPool)
+        return;
+
+    if (isEmpty() && d->m_numLayoutSavers == 0 && m_groups.isEmpty()) {
+        // Pooled floating windows don't keep us alive
+        d->drainFloatingWindowPool();
         delete this;
+    }
 }
 
-void DockRegistry::onFocusedViewChanged(std::shared_ptr<View> view)
+void DockRegistry::Private::drainFloatingWindowPool(Core::MainWindow *mainWindow)
 {
-    auto p = view;
-    while (p && !p->isNull()) {
-        if (auto group = p->asGroupController()) {
-            // Special case: The focused widget is inside the group but not inside the dockwidget.
-            // For example, it's a line edit in the QTabBar. We still need to send the signal for
-            // the current dw in the tab group
-            if (auto dw = group->currentDockWidget()) {
-                setFocusedDockWidget(dw);
-            }
+    if (m_floatingWindowPool.isEmpty())
+        return;
 
-            return;
-        }
+    // Deleting a floating window unregisters it, which would re-enter maybeDelete()
+    ScopedValueRollback guard(m_drainingFloatingWindowPool, true);
 
-        if (auto dw = p->asDockWidgetController()) {
-            DockRegistry::self()->setFocusedDockWidget(dw);
-            return;
-        }
-        p = p->parentView();
+    Vector<Core::FloatingWindow *> toDelete;
+    for (auto fw : std::as_const(m_floatingWindowPool)) {
+        if (!mainWindow || fw->dptr()->m_parent == mainWindow)
+            toDelete.push_back(fw);
     }
 
-    setFocusedDockWidget(nullptr);
+    for (auto fw : std::as_const(toDelete)) {
+        m_floatingWindowPool.removeOne(fw);
+        delete fw;
+    }
 }
 
 void DockRegistry::setFocusedDockWidget(Core::DockWidget *dw)
@@ -150,6 +196,36 @@ bool DockRegistry::affinitiesMatch(const Vector<QString> &affinities1,
     return false;
 }
 
+bool DockRegistry::affinitiesMatch(const AffinitySet &affinities1, const AffinitySet &affinities2) const
+{
+    const uint64_t common = affinities1.mask & affinities2.mask;
+    if (common & ~AffinitySet::OverflowBit)
+        return true;
+
+    if (common != 0) {
+        // Only names past the 63rd have the overflow bit in common, they might still differ
+        return affinitiesMatch(affinities1.names, affinities2.names);
+    }
+
+    return affinities1.names.isEmpty() && affinities2.names.isEmpty();
+}
+
+AffinitySet DockRegistry::internAffinities(const Vector<QString> &names) const
+{
+    AffinitySet result;
+    result.names = names;
+
+    for (const QString &name : names) {
+        auto it = d->m_affinityBits.find(name);
+        if (it == d->m_affinityBits.end())
+            it = d->m_affinityBits.insert({ name, int(d->m_affinityBits.size()) }).first;
+
+        result.mask |= it->second < 63 ? uint64_t(1) << it->second : AffinitySet::OverflowBit;
+    }
+
+    return result;
+}
+
 Vector<QString> DockRegistry::mainWindowsNames() const
 {
     Vector<QString> names;
@@ -217,6 +293,11 @@ bool DockRegistry::isProbablyObscured(Core::Window::Ptr target, WindowBeingDragg
     return isProbablyObscured(target, fw);
 }
 
+void DockRegistry::onFloatingWindowRaised(Core::FloatingWindow *fw)
+{
+    d->m_floatingWindowZOrder.raise(fw);
+}
+
 SideBarLocation DockRegistry::sideBarLocationForDockWidget(const Core::DockWidget *dw) const
 {
     if (Core::SideBar *sb = sideBarForDockWidget(dw))
@@ -241,14 +322,17 @@ Core::Group *DockRegistry::groupInMDIResize() const
         if (!mw->isMDI())
             continue;
 
-        Layout *layout = mw->layout();
-        const Vector<Core::Group *> groups = layout->groups();
-        for (Core::Group *group : groups) {
+        Core::Group *result = nullptr;
+        mw->layout()->visitGroups([&result](Core::Group *group) {
             if (WidgetResizeHandler *wrh = group->resizeHandler()) {
                 if (wrh->isResizing())
-                    return group;
+                    result = group;
             }
-        }
+            return result == nullptr;
+        });
+
+        if (result)
+            return result;
     }
 
     return nullptr;
@@ -271,13 +355,18 @@ DockRegistry::Private *DockRegistry::dptr() const
 
 Core::MainWindow::List
 DockRegistry::mainWindowsWithAffinity(const Vector<QString> &affinities) const
+{
+    return mainWindowsWithAffinity(internAffinities(affinities));
+}
+
+Core::MainWindow::List
+DockRegistry::mainWindowsWithAffinity(const AffinitySet &affinities) const
 {
     Core::MainWindow::List result;
     result.reserve(m_mainWindows.size());
 
     for (auto mw : m_mainWindows) {
-        const Vector<QString> mwAffinities = mw->affinities();
-        if (affinitiesMatch(mwAffinities, affinities))
+        if (affinitiesMatch(mw->affinitySet(), affinities))
             result.push_back(mw);
     }
 
@@ -289,6 +378,55 @@ Core::Layout *DockRegistry::layoutForItem(const Item *item) const
     return Layout::fromLayoutingHost(item->host());
 }
 
+Vector<DockRegistry::LayoutStatisticsSnapshot> DockRegistry::layoutStatistics() const
+{
+    Vector<LayoutStatisticsSnapshot> result;
+    result.reserve(m_mainWindows.size() + m_floatingWindows.size());
+
+    for (Core::MainWindow *mw : m_mainWindows) {
+        if (Core::Layout *layout = mw->layout())
+            result.push_back({ mw->uniqueName(), /*isFloating=*/false, layout->statistics() });
+    }
+
+    for (Core::FloatingWindow *fw : m_floatingWindows) {
+        if (fw->beingDeleted())
+            continue;
+
+        QString name;
+        for (Core::DockWidget *dw : fw->dockWidgets()) {
+            if (!name.isEmpty())
+                name += QStringLiteral(", ");
+            name += dw->uniqueName();
+        }
+
+        result.push_back({ name, /*isFloating=*/true, fw->layout()->statistics() });
+    }
+
+    return result;
+}
+
+void DockRegistry::resetLayoutStatistics()
+{
+    for (Core::MainWindow *mw : std::as_const(m_mainWindows)) {
+        if (Core::Layout *layout = mw->layout())
+            layout->resetStatistics();
+    }
+
+    for (Core::FloatingWindow *fw : std::as_const(m_floatingWindows))
+        fw->layout()->resetStatistics();
+}
+
+void DockRegistry::finishLayoutTransitions()
+{
+    for (Core::MainWindow *mw : std::as_const(m_mainWindows)) {
+        if (Core::Layout *layout = mw->layout())
+            layout->asLayoutingHost()->finishTransitions();
+    }
+
+    for (Core::FloatingWindow *fw : std::as_const(m_floatingWindows))
+        fw->layout()->asLayoutingHost()->finishTransitions();
+}
+
 bool DockRegistry::itemIsInMainWindow(const Item *item) const
 {
     if (Core::Layout *layout = layoutForItem(item)) {
@@ -318,6 +456,7 @@ void DockRegistry::registerDockWidget(Core::DockWidget *dock)
     }
 
     m_dockWidgets.push_back(dock);
+    addToNameIndex(d->m_dockWidgetsByName, dock->uniqueName(), dock, d->m_numNameConflicts);
 }
 
 void DockRegistry::unregisterDockWidget(Core::DockWidget *dock)
@@ -326,6 +465,7 @@ void DockRegistry::unregisterDockWidget(Core::DockWidget *dock)
         d->m_focusedDockWidget = nullptr;
 
     m_dockWidgets.removeOne(dock);
+    removeFromNameIndex(d->m_dockWidgetsByName, dock->uniqueName(), dock, d->m_numNameConflicts);
     m_sideBarGroupings->removeFromGroupings(dock);
 
     maybeDelete();
@@ -340,25 +480,40 @@ void DockRegistry::registerMainWindow(Core::MainWindow *mainWindow)
     }
 
     m_mainWindows.push_back(mainWindow);
+    addToNameIndex(d->m_mainWindowsByName, mainWindow->uniqueName(), mainWindow, d->m_numNameConflicts);
     Platform::instance()->onMainWindowCreated(mainWindow);
 }
 
 void DockRegistry::unregisterMainWindow(Core::MainWindow *mainWindow)
 {
     m_mainWindows.removeOne(mainWindow);
+    removeFromNameIndex(d->m_mainWindowsByName, mainWindow->uniqueName(), mainWindow, d->m_numNameConflicts);
+    d->drainFloatingWindowPool(mainWindow);
     Platform::instance()->onMainWindowDestroyed(mainWindow);
     maybeDelete();
 }
 
+void DockRegistry::onDockWidgetRenamed(Core::DockWidget *dock, const QString &oldName)
+{
+    if (!m_dockWidgets.contains(dock))
+        return;
+
+    removeFromNameIndex(d->m_dockWidgetsByName, oldName, dock, d->m_numNameConflicts);
+    addToNameIndex(d->m_dockWidgetsByName, dock->uniqueName(), dock, d->m_numNameConflicts);
+}
+
 void DockRegistry::registerFloatingWindow(Core::FloatingWindow *fw)
 {
     m_floatingWindows.push_back(fw);
+    d->m_floatingWindowZOrder.add(fw);
     Platform::instance()->onFloatingWindowCreated(fw);
 }
 
 void DockRegistry::unregisterFloatingWindow(Core::FloatingWindow *fw)
 {
     m_floatingWindows.removeOne(fw);
+    d->m_floatingWindowZOrder.remove(fw);
+    d->m_floatingWindowPool.removeOne(fw);
     Platform::instance()->onFloatingWindowDestroyed(fw);
     maybeDelete();
 }
@@ -402,10 +557,8 @@ bool DockRegistry::containsMainWindow(const QString &uniqueName) const
 
 Core::DockWidget *DockRegistry::dockByName(const QString &name, DockByNameFlags flags) const
 {
-    for (auto dock : std::as_const(m_dockWidgets)) {
-        if (dock->uniqueName() == name)
-            return dock;
-    }
+    if (auto dock = firstInNameIndex(d->m_dockWidgetsByName, name))
+        return dock;
 
     if (flags.testFlag(DockByNameFlag::ConsultRemapping)) {
         // Name doesn't exist, let's check if it was remapped during a layout restore.
@@ -436,43 +589,35 @@ Core::DockWidget *DockRegistry::dockByName(const QString &name, DockByNameFlags
 
 Core::MainWindow *DockRegistry::mainWindowByName(const QString &name) const
 {
-    for (auto mainWindow : std::as_const(m_mainWindows)) {
-        if (mainWindow->uniqueName() == name)
-            return mainWindow;
-    }
-
-    return nullptr;
+    return firstInNameIndex(d->m_mainWindowsByName, name);
 }
 
 bool DockRegistry::isSane() const
 {
-    std::set<QString> names;
-    for (auto dock : std::as_const(m_dockWidgets)) {
-        const QString name = dock->uniqueName();
-        if (name.isEmpty()) {
-            KDDW_ERROR("DockRegistry::isSane: DockWidget is missing a name");
-            return false;
-        } else if (names.find(name) != names.cend()) {
-            KDDW_ERROR("DockRegistry::isSane: dockWidgets with duplicate names: {}", name);
-            return false;
-        } else {
-            names.insert(name);
+    // Names are validated as they get registered, only look for the offending ones if there's any
+    if (d->m_numNameConflicts > 0) {
+        for (const auto &it : d->m_dockWidgetsByName) {
+            if (it.first.isEmpty()) {
+                KDDW_ERROR("DockRegistry::isSane: DockWidget is missing a name");
+                return false;
+            } else if (it.second.size() > 1) {
+                KDDW_ERROR("DockRegistry::isSane: dockWidgets with duplicate names: {}", it.first);
+                return false;
+            }
         }
-    }
 
-    names.clear();
-    for (auto mainwindow : std::as_const(m_mainWindows)) {
-        const QString name = mainwindow->uniqueName();
-        if (name.isEmpty()) {
-            KDDW_ERROR("DockRegistry::isSane: MainWindow is missing a name");
-            return false;
-        } else if (names.find(name) != names.cend()) {
-            KDDW_ERROR("DockRegistry::isSane: mainWindow with duplicate names: {}", name);
-            return false;
-        } else {
-            names.insert(name);
+        for (const auto &it : d->m_mainWindowsByName) {
+            if (it.first.isEmpty()) {
+                KDDW_ERROR("DockRegistry::isSane: MainWindow is missing a name");
+                return false;
+            } else if (it.second.size() > 1) {
+                KDDW_ERROR("DockRegistry::isSane: mainWindow with duplicate names: {}", it.first);
+                return false;
+            }
         }
+    }
 
+    for (auto mainwindow : std::as_const(m_mainWindows)) {
         if (!mainwindow->layout()->checkSanity())
             return false;
     }
@@ -554,7 +699,7 @@ Vector<Core::FloatingWindow *> DockRegistry::floatingWindows(bool includeBeingDe
     // Returns all the FloatingWindow which aren't being deleted
     Vector<Core::FloatingWindow *> result;
     result.reserve(m_floatingWindows.size());
-    for (Core::FloatingWindow *fw : m_floatingWindows) {
+    for (Core::FloatingWindow *fw : d->m_floatingWindowZOrder.windows()) {
         if (!includeBeingDeleted && fw->beingDeleted())
             continue;
 
@@ -571,7 +716,7 @@ Window::List DockRegistry::floatingQWindows() const
 {
     Window::List windows;
     windows.reserve(m_floatingWindows.size());
-    for (Core::FloatingWindow *fw : m_floatingWindows) {
+    for (Core::FloatingWindow *fw : d->m_floatingWindowZOrder.windows()) {
         if (!fw->beingDeleted()) {
             if (Core::Window::Ptr window = fw->view()->window()) {
                 windows.push_back(window);
@@ -630,7 +775,7 @@ Window::List DockRegistry::topLevels(bool excludeFloatingDocks) const
     windows.reserve(m_floatingWindows.size() + m_mainWindows.size());
 
     if (!excludeFloatingDocks) {
-        for (Core::FloatingWindow *fw : m_floatingWindows) {
+        for (Core::FloatingWindow *fw : d->m_floatingWindowZOrder.windows()) {
             if (fw->isVisible()) {
                 if (Core::Window::Ptr window = fw->view()->window()) {
                     windows.push_back(window);
@@ -664,15 +809,16 @@ void DockRegistry::clear(const Core::DockWidget::List &dockWidgets,
                          const Core::MainWindow::List &mainWindows,
                          const Vector<QString> &affinities)
 {
+    const AffinitySet affinitySet = internAffinities(affinities);
     for (auto dw : std::as_const(dockWidgets)) {
-        if (affinities.isEmpty() || affinitiesMatch(affinities, dw->affinities())) {
+        if (affinities.isEmpty() || affinitiesMatch(affinitySet, dw->affinitySet())) {
             dw->forceClose();
             dw->d->lastPosition()->removePlaceholders();
         }
     }
 
     for (auto mw : std::as_const(mainWindows)) {
-        if (affinities.isEmpty() || affinitiesMatch(affinities, mw->affinities())) {
+        if (affinities.isEmpty() || affinitiesMatch(affinitySet, mw->affinitySet())) {
             mw->layout()->clearLayout();
         }
     }
@@ -695,8 +841,8 @@ bool DockRegistry::onMouseButtonPress(View *view, MouseEvent *event)
         // When clicking on a MDI Group we raise the window
         if (Controller *c = view->d->firstParentOfType(ViewType::Group)) {
             auto group = static_cast<Group *>(c);
-            if (group->isMDI())
-                group->view()->raise();
+            if (MDILayout *layout = group->mdiLayout())
+                layout->raiseDockWidget(group);
         }
     }
 
@@ -766,8 +912,7 @@ bool DockRegistry::onExposeEvent(Core::Window::Ptr window)
 {
     if (Core::FloatingWindow *fw = floatingWindowForHandle(window)) {
         // This floating window was exposed
-        m_floatingWindows.removeOne(fw);
-        m_floatingWindows.append(fw);
+        d->m_floatingWindowZOrder.raise(fw);
     }
 
     return false;
@@ -36,6 +36,7 @@ class SideBarGroupings;
 class MainWindow;
 class DockWidget;
 class Group;
+class FocusRouter;
 class MainWindowMDIViewInterface;
 class MainWindowViewInterface;
 class FocusScope;
@@ -115,11 +116,12 @@ public:
 
     ///@brief returns all FloatingWindow instances. Not necessarily all floating dock widgets,
     /// As there might be DockWidgets which weren't morphed yet.
+    /// They are ordered by z-order, the last one being on top.
     Vector<Core::FloatingWindow *>
     floatingWindows(bool includeBeingDeleted = false, bool honourSkipped = false) const;
 
     ///@brief overload that returns list of QWindow. This is more friendly for supporting both
-    /// QtWidgets and QtQuick
+    /// QtWidgets and QtQuick. Also ordered by z-order.
     Vector<std::shared_ptr<Core::Window>> floatingQWindows() const;
 
     ///@brief returns whether if there's at least one floating window
@@ -183,15 +185,49 @@ public:
      */
     Vector<Core::MainWindow *> mainWindowsWithAffinity(const Vector<QString> &affinities) const;
 
+    /// @overload
+    Vector<Core::MainWindow *> mainWindowsWithAffinity(const AffinitySet &affinities) const;
+
     /// @brief Returns the Layout where the specified item is in
     Core::Layout *layoutForItem(const Core::Item *) const;
 
+    /// @brief A layout's statistics, as returned by layoutStatistics()
+    struct LayoutStatisticsSnapshot
+    {
+        /// The main window's unique name. For floating windows, the unique names of their dock widgets.
+        QString name;
+        bool isFloating = false;
+        LayoutStatistics statistics;
+    };
+
+    /// @brief Returns the statistics of every main window and floating window layout
+    /// Only recorded while Config::layoutProfilingEnabled() is true.
+    Vector<LayoutStatisticsSnapshot> layoutStatistics() const;
+
+    /// @brief Clears the statistics of every layout
+    void resetLayoutStatistics();
+
+    /// @brief Moves every group still in a layout transition to its final geometry
+    /// Called before reading geometries that must not be mid-animation, like when saving or
+    /// restoring a layout, or when a drag starts. @sa Config::setLayoutTransitionDuration()
+    void finishLayoutTransitions();
+
     /// @brief Returns whether the item is in a main window.
     /// Nesting is honoured. (MDIArea inside DropArea inside MainWindow, for example)
     bool itemIsInMainWindow(const Core::Item *) const;
 
     bool affinitiesMatch(const Vector<QString> &affinities1, const Vector<QString> &affinities2) const;
 
+    /// @overload
+    /// A bitwise AND, unless more than 63 distinct affinity names are in use.
+    bool affinitiesMatch(const AffinitySet &affinities1, const AffinitySet &affinities2) const;
+
+    /// @brief Returns @p names with their bits, assigning bits to the names which don't have one yet
+    AffinitySet internAffinities(const Vector<QString> &names) const;
+
+    /// @brief Called by DockWidget when its unique name changes after it was registered
+    void onDockWidgetRenamed(Core::DockWidget *, const QString &oldName);
+
     /// @brief Returns a list of all known main window unique names
     Vector<QString> mainWindowsNames() const;
 
@@ -209,6 +245,11 @@ public:
     /// @overload
     bool isProbablyObscured(std::shared_ptr<Core::Window> target, Core::WindowBeingDragged *exclude) const;
 
+    /// @brief Moves @p fw to the top of the z-order returned by floatingWindows()
+    /// Exposes and window activations are tracked already, this is for programmatic raises,
+    /// which the platform might not report.
+    void onFloatingWindowRaised(Core::FloatingWindow *fw);
+
     ///@brief Returns whether the specified dock widget is in a side bar, and which.
     /// SideBarLocation::None is returned if it's not in a sidebar.
     /// This is only relevant when using the auto-hide and side-bar feature.
@@ -228,11 +269,11 @@ public:
 
 private:
     friend class Core::FocusScope;
+    friend class Core::FocusRouter;
     friend class Core::TitleBar;
 
     explicit DockRegistry(Core::Object *parent = nullptr);
     bool onDockWidgetPressed(Core::DockWidget *dw, MouseEvent *);
-    void onFocusedViewChanged(std::shared_ptr<Core::View> view);
     void maybeDelete();
     void setFocusedDockWidget(Core::DockWidget *);
 
@@ -11,9 +11,12 @@
 
 #include "DockRegistry.h"
 #include "ObjectGuard_p.h"
+#include "FloatingWindowZOrder_p.h"
 
 #include <kdbindings/signal.h>
 
+#include <unordered_map>
+
 
 #pragma once
 
@@ -36,11 +39,35 @@ public:
     /// @param inhibited
     KDBindings::Signal<bool> dropIndicatorsInhibitedChanged;
 
-    KDBindings::ConnectionHandle m_connection;
+    KDBindings::ScopedConnection m_windowActivatedConnection;
+
+    /// @brief The registered floating windows, by stacking order
+    Core::FloatingWindowZOrder m_floatingWindowZOrder;
 
     int m_numLayoutSavers = 0;
 
     CloseReason m_currentCloseReason = CloseReason::Unspecified;
+
+    /// @brief Empty and hidden floating windows kept for reuse. They aren't registered.
+    /// @sa Config::setFloatingWindowPoolSize()
+    Vector<Core::FloatingWindow *> m_floatingWindowPool;
+    bool m_drainingFloatingWindowPool = false;
+
+    /// @brief The registered dock widgets and main windows by unique name, in registration order
+    /// Kept up to date on registration, so lookups by name don't need to scan every instance.
+    std::unordered_map<QString, Vector<Core::DockWidget *>> m_dockWidgetsByName;
+    std::unordered_map<QString, Vector<Core::MainWindow *>> m_mainWindowsByName;
+
+    /// @brief How many registered dock widgets and main windows have an empty or already taken name
+    /// isSane() only looks for the offending ones when this isn't 0.
+    int m_numNameConflicts = 0;
+
+    /// @brief The bit of each affinity name, assigned in the order they're first seen
+    std::unordered_map<QString, int> m_affinityBits;
+
+    /// @brief Deletes the pooled floating windows parented to @p mainWindow.
+    /// If @p mainWindow is nullptr then the whole pool is deleted.
+    void drainFloatingWindowPool(Core::MainWindow *mainWindow = nullptr);
 };
 
 }
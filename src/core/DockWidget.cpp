@@ -42,6 +42,8 @@
 #include <QTimer>
 #endif
 
+#include <chrono>
+
 /**
  * @file
  * @brief The DockWidget base-class that's shared between QtWidgets and QtQuick stack.
@@ -102,7 +104,7 @@ void DockWidget::addDockWidgetAsTab(DockWidget *other, const InitialOption &opti
         return;
     }
 
-    if (!DockRegistry::self()->affinitiesMatch(other->affinities(), d->affinities)) {
+    if (!DockRegistry::self()->affinitiesMatch(other->affinitySet(), d->affinities)) {
         KDDW_ERROR("Refusing to dock widget with incompatible affinity. {} {}", other->affinities(), affinities());
         return;
     }
@@ -158,7 +160,7 @@ void DockWidget::addDockWidgetToContainingWindow(DockWidget *other, Location loc
         return;
     }
 
-    if (!DockRegistry::self()->affinitiesMatch(other->affinities(), d->affinities)) {
+    if (!DockRegistry::self()->affinitiesMatch(other->affinitySet(), d->affinities)) {
         KDDW_ERROR("Refusing to dock widget with incompatible affinity. {} {}", other->affinities(), affinities());
         return;
     }
@@ -201,6 +203,57 @@ void DockWidget::setGuestView(std::shared_ptr<View> guest)
     d->guestViewChanged.emit();
 }
 
+void DockWidget::setLazyGuestView(const std::function<std::shared_ptr<View>()> &factory)
+{
+    d->lazyGuestFactory = factory;
+    d->lazyGuestReport = {};
+    d->lazyGuestReport.isLazy = true;
+
+    // Already visible, no point in waiting
+    if (view()->isVisible())
+        createPendingGuestView();
+}
+
+bool DockWidget::hasPendingGuestView() const
+{
+    return bool(d->lazyGuestFactory);
+}
+
+static int countViews_recursive(View *view)
+{
+    int count = 1;
+    for (const auto &child : view->childViews())
+        count += countViews_recursive(child.get());
+
+    return count;
+}
+
+void DockWidget::createPendingGuestView()
+{
+    if (!d->lazyGuestFactory)
+        return;
+
+    // Clear it first, as showing the guest might get us here again
+    const auto factory = std::move(d->lazyGuestFactory);
+    d->lazyGuestFactory = {};
+
+    const auto start = std::chrono::steady_clock::now();
+    setGuestView(factory());
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    d->lazyGuestReport.created = true;
+    d->lazyGuestReport.creationTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    if (auto guest = guestView())
+        d->lazyGuestReport.numViews = countViews_recursive(guest.get());
+
+    KDDW_DEBUG("DockWidget::createPendingGuestView: Created guest for {} in {}us", uniqueName(), d->lazyGuestReport.creationTimeUs);
+}
+
+DockWidget::LazyGuestReport DockWidget::lazyGuestReport() const
+{
+    return d->lazyGuestReport;
+}
+
 bool DockWidget::isFloating() const
 {
     if (view()->isRootView())
@@ -428,6 +481,11 @@ bool DockWidget::isOpen() const
 }
 
 Vector<QString> DockWidget::affinities() const
+{
+    return d->affinities.names;
+}
+
+const AffinitySet &DockWidget::affinitySet() const
 {
     return d->affinities;
 }
@@ -459,9 +517,10 @@ void DockWidget::raise()
     if (auto fw = floatingWindow()) {
         fw->view()->raise();
         fw->view()->activateWindow();
+        DockRegistry::self()->onFloatingWindowRaised(fw);
     } else if (Core::Group *group = d->group()) {
-        if (group->isMDI())
-            group->view()->raise();
+        if (MDILayout *layout = group->mdiLayout())
+            layout->raiseDockWidget(group);
     }
 }
 
@@ -497,10 +556,10 @@ void DockWidget::setAffinities(const Vector<QString> &affinityNames)
     Vector<QString> affinities = affinityNames;
     affinities.removeAll(QString());
 
-    if (d->affinities == affinities)
+    if (d->affinities.names == affinities)
         return;
 
-    if (!d->affinities.isEmpty()) {
+    if (!d->affinities.names.isEmpty()) {
         /// There's too many use cases to consider if we allowed this
         /// - What if dock widget is docked already, it would possibly get incompatible affinity
         /// - If it's floating, but has some main window as transient parent, then the transient parent
@@ -511,7 +570,7 @@ void DockWidget::setAffinities(const Vector<QString> &affinityNames)
         return;
     }
 
-    d->affinities = affinities;
+    d->affinities = DockRegistry::self()->internAffinities(affinities);
 }
 
 void DockWidget::moveToSideBar()
@@ -623,7 +682,7 @@ Core::FloatingWindow *DockWidget::Private::morphIntoFloatingWindow()
         geo.setSize(geo.size().boundedTo(group->view()->maxSizeHint()));
         geo.setSize(geo.size().expandedTo(group->view()->minSize()));
         Core::FloatingWindow::ensureRectIsOnScreen(geo);
-        auto floatingWindow = new Core::FloatingWindow(group, geo);
+        auto floatingWindow = Core::FloatingWindow::create(group, geo);
 
         Core::AtomicSanityChecks checks(floatingWindow->dropArea()->rootItem());
         floatingWindow->view()->show();
@@ -949,7 +1008,7 @@ Core::DockWidget *DockWidget::deserialize(const LayoutSaver::DockWidget::Ptr &sa
 
         if (dw->affinities() != saved->affinities) {
             KDDW_ERROR("Affinity name changed from {} to {}", dw->affinities(), "; to", saved->affinities);
-            dw->d->affinities = saved->affinities;
+            dw->d->affinities = dr->internAffinities(saved->affinities);
         }
 
         dw->dptr()->m_lastCloseReason = saved->lastCloseReason;
@@ -1183,8 +1242,10 @@ void DockWidget::Private::setUniqueName(const QString &name)
 {
     if (name.isEmpty()) {
         KDDW_ERROR("DockWidget::Private::setUniqueName: Name is empty");
-    } else {
+    } else if (name != m_uniqueName) {
+        const QString oldName = m_uniqueName;
         m_uniqueName = name;
+        DockRegistry::self()->onDockWidgetRenamed(q, oldName);
     }
 }
 
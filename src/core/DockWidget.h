@@ -29,6 +29,8 @@
 #include "kddockwidgets/core/Controller.h"
 #include "kddockwidgets/core/Action.h"
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 
 // clazy:excludeall=ctor-missing-parent-argument
@@ -124,6 +126,37 @@ public:
     /// @brief Like widget() but returns a view
     std::shared_ptr<View> guestView() const;
 
+    /// Like setGuestView(), but @p factory is only called once the dock widget is first shown.
+    /// Until then guestView() returns nullptr.
+    /// Useful for applications registering many dock widgets but only showing a few of them at a
+    /// time, such as those restored as closed or sitting in a tab which isn't current.
+    /// Note that the guest's min and max size are only honoured once it's created.
+    /// Only the guest is deferred. The title bar and tab bar belong to the Group, which only exists
+    /// while the dock widget is open, and a tab which isn't current shares its Group's.
+    void setLazyGuestView(const std::function<std::shared_ptr<View>()> &factory);
+
+    /// Returns whether setLazyGuestView() was called and the guest wasn't created yet
+    bool hasPendingGuestView() const;
+
+    /// Creates the guest passed to setLazyGuestView(), if it wasn't created yet.
+    /// Called automatically when the dock widget is shown.
+    void createPendingGuestView();
+
+    /// How much creating the guest passed to setLazyGuestView() cost
+    struct LazyGuestReport
+    {
+        /// Whether setLazyGuestView() was called
+        bool isLazy = false;
+        /// Whether the guest was created already
+        bool created = false;
+        /// Time spent in the factory, in microseconds
+        int64_t creationTimeUs = 0;
+        /// Number of views in the guest's tree, a rough measure of its memory footprint
+        int numViews = 0;
+    };
+
+    LazyGuestReport lazyGuestReport() const;
+
     /**
      * @brief Returns whether the dock widget is floating.
      * Floating means it's not docked and has a window of its own.
@@ -311,6 +344,10 @@ public:
      */
     Vector<QString> affinities() const;
 
+    /// @internal
+    /// @brief Returns the affinities, interned for matching
+    const AffinitySet &affinitySet() const;
+
     /// @brief Opens this dock widget.
     /// Does nothing if already open.
     /// The dock widget will appear floating unless it knows about its previous layout position,
@@ -263,11 +263,13 @@ private:
     QString m_uniqueName;
 
 public:
-    Vector<QString> affinities;
+    AffinitySet affinities;
     QString title;
     Icon titleBarIcon;
     Icon tabBarIcon;
     std::shared_ptr<View> guest;
+    std::function<std::shared_ptr<View>()> lazyGuestFactory;
+    DockWidget::LazyGuestReport lazyGuestReport;
     DockWidget *const q;
     DockWidgetOptions options;
     FloatingWindowFlags m_flags = FloatingWindowFlag::FromGlobalConfig;
@@ -26,6 +26,7 @@
 #include "core/FloatingWindow.h"
 #include "core/DockWidget_p.h"
 #include "core/ScopedValueRollback_p.h"
+#include "core/DelayedCall_p.h"
 
 #ifdef KDDW_FRONTEND_QT
 #include "../qtcommon/DragControllerWayland_p.h"
@@ -37,6 +38,7 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <cstdlib>
 
 #if defined(Q_OS_WIN)
@@ -99,6 +101,26 @@ FallbackMouseGrabber::~FallbackMouseGrabber()
 {
 }
 
+
+/// @brief Processes the latest mouse move compressed by DragController
+class DelayedMouseMove : public DelayedCall
+{
+public:
+    explicit DelayedMouseMove(DragController *dragController)
+        : m_dragController(dragController)
+    {
+    }
+
+    void call() override
+    {
+        if (m_dragController)
+            m_dragController->flushPendingMouseMove();
+    }
+
+private:
+    ObjectGuard<DragController> m_dragController;
+};
+
 }
 
 State::State(MinimalStateMachine *parent)
@@ -169,7 +191,7 @@ StateNone::StateNone(DragController *parent)
 
 void StateNone::onEntry()
 {
-    KDDW_DEBUG("StateNone entered");
+    KDDW_CDEBUG(Drag, "StateNone entered");
     q->m_pressPos = Point();
     q->m_offset = Point();
     q->m_draggable = nullptr;
@@ -194,8 +216,8 @@ void StateNone::onEntry()
 // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
 bool StateNone::handleMouseButtonPress(Draggable *draggable, Point globalPos, Point pos)
 {
-    KDDW_DEBUG("StateNone::handleMouseButtonPress: draggable={} ; globalPos={}", ( void * )draggable,
-               globalPos);
+    KDDW_CDEBUG(Drag, "StateNone::handleMouseButtonPress: draggable={} ; globalPos={}", ( void * )draggable,
+                globalPos);
 
     if (!draggable) {
         KDDW_ERROR("StateNone::handleMouseButtonPress: null draggable");
@@ -226,7 +248,7 @@ StatePreDrag::~StatePreDrag() = default;
 
 void StatePreDrag::onEntry()
 {
-    KDDW_DEBUG("StatePreDrag entered {}", q->m_draggableGuard.isNull());
+    KDDW_CDEBUG(Drag, "StatePreDrag entered {}", q->m_draggableGuard.isNull());
     WidgetResizeHandler::s_disableAllHandlers = true; // Disable the resize handler during dragging
 }
 
@@ -280,8 +302,8 @@ StateDragging::StateDragging(DragController *parent)
 
         const bool mouseButtonIsReallyDown = (GetKeyState(VK_LBUTTON) & 0x8000);
         if (!mouseButtonIsReallyDown && Platform::instance()->isLeftMouseButtonPressed()) {
-            KDDW_DEBUG("Canceling drag, Qt thinks mouse button is pressed"
-                       "but Windows knows it's not");
+            KDDW_CDEBUG(Drag, "Canceling drag, Qt thinks mouse button is pressed"
+                              "but Windows knows it's not");
             handleMouseButtonRelease(Platform::instance()->cursorPos());
             q->dragCanceled.emit();
         }
@@ -303,6 +325,9 @@ void StateDragging::onEntry()
         return;
     }
 
+    // Drop indicators and the window being dragged need the final geometries, not mid-animation ones
+    DockRegistry::self()->finishLayoutTransitions();
+
     if (DockWidget *dw = q->m_draggable->singleDockWidget()) {
         // When we start to drag a floating window which has a single dock widget, we save the
         // position
@@ -339,7 +364,7 @@ void StateDragging::onEntry()
         KDDW_UNUSED(needsUndocking);
 #endif
 
-        KDDW_DEBUG("StateDragging entered. m_draggable={}; m_windowBeingDragged={}", ( void * )q->m_draggable, ( void * )q->m_windowBeingDragged->floatingWindow());
+        KDDW_CDEBUG(Drag, "StateDragging entered. m_draggable={}; m_windowBeingDragged={}", ( void * )q->m_draggable, ( void * )q->m_windowBeingDragged->floatingWindow());
 
         auto fw = q->m_windowBeingDragged->floatingWindow();
 #ifdef Q_OS_LINUX
@@ -394,6 +419,9 @@ void StateDragging::onEntry()
 
 void StateDragging::onExit()
 {
+    // A compressed move that didn't make it before the drag ended is obsolete
+    q->m_hasPendingMove = false;
+
 #if defined(KDDW_FRONTEND_QT_WINDOWS) && !defined(DOCKS_DEVELOPER_MODE)
     m_maybeCancelDrag.stop();
 #endif
@@ -406,18 +434,18 @@ void StateDragging::onExit()
 
 bool StateDragging::handleMouseButtonRelease(Point globalPos)
 {
-    KDDW_DEBUG("StateDragging: handleMouseButtonRelease");
+    KDDW_CDEBUG(Drag, "StateDragging: handleMouseButtonRelease");
 
     FloatingWindow *floatingWindow = q->m_windowBeingDragged->floatingWindow();
     if (!floatingWindow) {
         // It was deleted externally
-        KDDW_DEBUG("StateDragging: Bailling out, deleted externally");
+        KDDW_CDEBUG(Drag, "StateDragging: Bailling out, deleted externally");
         q->dragCanceled.emit();
         return true;
     }
 
     if (floatingWindow->anyNonDockable()) {
-        KDDW_DEBUG("StateDragging: Ignoring floating window with non dockable widgets");
+        KDDW_CDEBUG(Drag, "StateDragging: Ignoring floating window with non dockable widgets");
         q->dragCanceled.emit();
         return true;
     }
@@ -426,11 +454,11 @@ bool StateDragging::handleMouseButtonRelease(Point globalPos)
         if (q->m_currentDropArea->drop(q->m_windowBeingDragged.get(), globalPos)) {
             q->dropped.emit();
         } else {
-            KDDW_DEBUG("StateDragging: Bailling out, drop not accepted");
+            KDDW_CDEBUG(Drag, "StateDragging: Bailling out, drop not accepted");
             q->dragCanceled.emit();
         }
     } else {
-        KDDW_DEBUG("StateDragging: Bailling out, not over a drop area");
+        KDDW_CDEBUG(Drag, "StateDragging: Bailling out, not over a drop area");
         q->dragCanceled.emit();
     }
     return true;
@@ -440,7 +468,7 @@ bool StateDragging::handleMouseMove(Point globalPos)
 {
     FloatingWindow *fw = q->m_windowBeingDragged->floatingWindow();
     if (!fw) {
-        KDDW_DEBUG("Canceling drag, window was deleted");
+        KDDW_CDEBUG(Drag, "Canceling drag, window was deleted");
         q->dragCanceled.emit();
         return true;
     }
@@ -468,10 +496,19 @@ bool StateDragging::handleMouseMove(Point globalPos)
         fw->view()->window()->setFramePosition(globalPos - q->m_offset);
 
     if (fw->anyNonDockable()) {
-        KDDW_DEBUG("StateDragging: Ignoring non dockable floating window");
+        KDDW_CDEBUG(Drag, "StateDragging: Ignoring non dockable floating window");
         return true;
     }
 
+    // Skip the top-level search and hover if the cursor barely moved within the same drop segment
+    const int hoverThreshold = Config::self().dragHoverThreshold();
+    if (hoverThreshold > 0 && q->m_currentDropArea
+        && (globalPos - q->m_lastHoverPos).manhattanLength() < hoverThreshold
+        && q->m_currentDropArea->isHoveringSameSegment(globalPos))
+        return true;
+
+    q->m_lastHoverPos = globalPos;
+
     DropArea *dropArea = q->dropAreaUnderCursor();
     if (q->m_currentDropArea && dropArea != q->m_currentDropArea)
         q->m_currentDropArea->removeHover();
@@ -479,7 +516,7 @@ bool StateDragging::handleMouseMove(Point globalPos)
     if (dropArea) {
         if (FloatingWindow *targetFw = dropArea->floatingWindow()) {
             if (targetFw->anyNonDockable()) {
-                KDDW_DEBUG("StateDragging: Ignoring non dockable target floating window");
+                KDDW_CDEBUG(Drag, "StateDragging: Ignoring non dockable target floating window");
                 return false;
             }
         }
@@ -511,7 +548,7 @@ StateInternalMDIDragging::~StateInternalMDIDragging()
 
 void StateInternalMDIDragging::onEntry()
 {
-    KDDW_DEBUG("StateInternalMDIDragging entered. draggable={}", ( void * )q->m_draggable);
+    KDDW_CDEBUG(Drag, "StateInternalMDIDragging entered. draggable={}", ( void * )q->m_draggable);
 
     if (!q->m_draggableGuard) {
         KDDW_ERROR("Draggable was destroyed, canceling the drag");
@@ -611,7 +648,7 @@ DragController::DragController(Core::Object *parent)
     , m_stateDragging(createDraggingState(this))
     , m_stateDraggingMDI(new StateInternalMDIDragging(this))
 {
-    KDDW_TRACE("DragController CTOR");
+    KDDW_CTRACE(Drag, "DragController CTOR");
 
     m_stateNone->addTransition(mousePressed, m_statePreDrag);
     m_statePreDrag->addTransition(dragCanceled, m_stateNone);
@@ -719,7 +756,7 @@ bool DragController::onDnDEvent(View *view, Event *e)
 
     // Wayland is very different. It uses QDrag for the dragging of a window.
     if (view) {
-        KDDW_DEBUG("DragController::onDnDEvent: ev={}, dropArea=", int(e->type()), ( void * )view->asDropAreaController());
+        KDDW_CDEBUG(Drag, "DragController::onDnDEvent: ev={}, dropArea=", int(e->type()), ( void * )view->asDropAreaController());
         if (auto dropArea = view->asDropAreaController()) {
             switch (int(e->type())) {
             case Event::DragEnter:
@@ -742,10 +779,10 @@ bool DragController::onDnDEvent(View *view, Event *e)
         }
     } else if (e->type() == Event::DragEnter && isDragging()) {
         // We're dragging a window. Be sure user code doesn't accept DragEnter events.
-        KDDW_DEBUG("DragController::onDnDEvent: Eating DragEnter.");
+        KDDW_CDEBUG(Drag, "DragController::onDnDEvent: Eating DragEnter.");
         return true;
     } else {
-        KDDW_DEBUG("DragController::onDnDEvent: No view. ev={}", int(e->type()));
+        KDDW_CDEBUG(Drag, "DragController::onDnDEvent: No view. ev={}", int(e->type()));
     }
 
     return false;
@@ -755,7 +792,7 @@ bool DragController::onMoveEvent(View *)
 {
     if (m_nonClientDrag) {
         // On Windows, non-client mouse moves are only sent at the end, so we must fake it:
-        KDDW_TRACE("DragController::onMoveEvent");
+        KDDW_CTRACE(Drag, "DragController::onMoveEvent");
         activeState()
             ->handleMouseMove(Platform::instance()->cursorPos());
     }
@@ -768,7 +805,7 @@ bool DragController::onMouseEvent(View *w, MouseEvent *me)
     if (!w)
         return false;
 
-    KDDW_TRACE("DragController::onMouseEvent e={} ; nonClientDrag={}", int(me->type()), m_nonClientDrag);
+    KDDW_CTRACE(Drag, "DragController::onMouseEvent e={} ; nonClientDrag={}", int(me->type()), m_nonClientDrag);
 
     switch (me->type()) {
     case Event::NonClientAreaMouseButtonPress: {
@@ -800,6 +837,12 @@ bool DragController::onMouseEvent(View *w, MouseEvent *me)
     case Event::MouseButtonRelease:
     case Event::NonClientAreaMouseButtonRelease: {
         ViewGuard guard(w);
+        if (m_hasPendingMove) {
+            // Honour the final position before dropping
+            m_pendingMovePos = Qt5Qt6Compat::eventGlobalPos(me);
+            flushPendingMouseMove();
+        }
+
         const bool inProgrammaticDrag = m_inProgrammaticDrag;
         const bool result = activeState()->handleMouseButtonRelease(Qt5Qt6Compat::eventGlobalPos(me));
 
@@ -818,6 +861,8 @@ bool DragController::onMouseEvent(View *w, MouseEvent *me)
 
     case Event::NonClientAreaMouseMove:
     case Event::MouseMove:
+        if (activeState() == m_stateDragging && Config::self().dragMotionCompression())
+            return compressMouseMove(Qt5Qt6Compat::eventGlobalPos(me));
         return activeState()->handleMouseMove(Qt5Qt6Compat::eventGlobalPos(me));
     case Event::MouseButtonDblClick:
     case Event::NonClientAreaMouseButtonDblClick:
@@ -829,6 +874,45 @@ bool DragController::onMouseEvent(View *w, MouseEvent *me)
     return false;
 }
 
+bool DragController::compressMouseMove(Point globalPos)
+{
+    m_pendingMovePos = globalPos;
+    if (m_hasPendingMove)
+        return true; // Already scheduled, will use the new position
+
+    m_hasPendingMove = true;
+
+    int delay = 0;
+    if (Config::self().dragMotionCappedAtRefreshRate()) {
+        View *view = m_windowBeingDragged && m_windowBeingDragged->floatingWindow()
+            ? m_windowBeingDragged->floatingWindow()->view()
+            : nullptr;
+        const double refreshRate = Platform::instance()->screenRefreshRateFor(view);
+        if (refreshRate > 0) {
+            using namespace std::chrono;
+            const auto frameDuration = duration<double, std::milli>(1000.0 / refreshRate);
+            const auto elapsed = duration<double, std::milli>(steady_clock::now() - m_lastCompressedMove);
+            if (elapsed < frameDuration)
+                delay = int(std::ceil((frameDuration - elapsed).count()));
+        }
+    }
+
+    Platform::instance()->runDelayed(delay, new DelayedMouseMove(this));
+    return true;
+}
+
+void DragController::flushPendingMouseMove()
+{
+    if (!m_hasPendingMove)
+        return;
+
+    m_hasPendingMove = false;
+    m_lastCompressedMove = std::chrono::steady_clock::now();
+
+    if (activeState() == m_stateDragging)
+        m_stateDragging->handleMouseMove(m_pendingMovePos);
+}
+
 StateBase *DragController::activeState() const
 {
     return static_cast<StateBase *>(currentState());
@@ -921,7 +1005,7 @@ static std::shared_ptr<View> qtTopLevelForHWND(HWND hwnd)
         }
     }
 
-    KDDW_TRACE("Couldn't find hwnd for top-level hwnd={}", ( void * )hwnd);
+    KDDW_CTRACE(Drag, "Couldn't find hwnd for top-level hwnd={}", ( void * )hwnd);
     return nullptr;
 }
 
@@ -942,7 +1026,7 @@ static std::shared_ptr<View> qtTopLevelUnderCursor_impl(Point globalPos,
             continue;
 
         if (window->geometry().contains(globalPos)) {
-            KDDW_TRACE("Found top-level {}", ( void * )tl.get());
+            KDDW_CTRACE(Drag, "Found top-level {}", ( void * )tl.get());
             return tl;
         }
     }
@@ -950,6 +1034,21 @@ static std::shared_ptr<View> qtTopLevelUnderCursor_impl(Point globalPos,
     return nullptr;
 }
 
+// On Linux we don't have API to check the z-order of top-levels. So first check the floating
+// windows and check the MainWindow last, as the MainWindow will have lower z-order as it's a parent
+// (TODO: How will it work with multiple MainWindows ?) The floating window list is sorted by
+// z-order, DockRegistry tracks exposes, activations and raises.
+static std::shared_ptr<View> topLevelUnderCursorByTrackedZOrder(Point globalPos,
+                                                                View *rootViewBeingDragged)
+{
+    if (auto tl = qtTopLevelUnderCursor_impl(
+            globalPos, DockRegistry::self()->floatingQWindows(), rootViewBeingDragged))
+        return tl;
+
+    return qtTopLevelUnderCursor_impl(
+        globalPos, DockRegistry::self()->topLevels(/*excludeFloatingDocks=*/true), rootViewBeingDragged);
+}
+
 std::shared_ptr<View> DragController::qtTopLevelUnderCursor() const
 {
     Point globalPos = Platform::instance()->cursorPos();
@@ -978,7 +1077,7 @@ std::shared_ptr<View> DragController::qtTopLevelUnderCursor() const
 
                 if (windowGeometry.contains(globalPos)
                     && tl->viewName() != QStringLiteral("_docks_IndicatorWindow_Overlay")) {
-                    KDDW_TRACE("Found top-level {}", ( void * )tl.get());
+                    KDDW_CTRACE(Drag, "Found top-level {}", ( void * )tl.get());
                     return tl;
                 }
             } else {
@@ -993,7 +1092,7 @@ std::shared_ptr<View> DragController::qtTopLevelUnderCursor() const
                                 if (topLevel->rect().contains(topLevel->mapFromGlobal(globalPos))
                                     && topLevel->objectName()
                                         != QStringLiteral("_docks_IndicatorWindow_Overlay")) {
-                                    KDDW_TRACE("Found top-level {}", ( void * )topLevel);
+                                    KDDW_CTRACE(Drag, "Found top-level {}", ( void * )topLevel);
                                     return QtCommon::Platform_qt::instance()->qobjectAsView(topLevel);
                                 }
                             }
@@ -1001,7 +1100,7 @@ std::shared_ptr<View> DragController::qtTopLevelUnderCursor() const
                     }
                 }
 #endif // QtWidgets A window belonging to another app is below the cursor
-                KDDW_TRACE("Window from another app is under cursor {}", ( void * )hwnd);
+                KDDW_CTRACE(Drag, "Window from another app is under cursor {}", ( void * )hwnd);
                 return nullptr;
             }
         }
@@ -1015,38 +1114,27 @@ std::shared_ptr<View> DragController::qtTopLevelUnderCursor() const
             return tl;
 
         if (!ok) {
-            KDDW_TRACE("No top-level found. Some windows weren't seen by XLib");
+            KDDW_CTRACE(Drag, "No top-level found. Some windows weren't seen by XLib, trying the tracked z-order");
+            return topLevelUnderCursorByTrackedZOrder(globalPos, tlwBeingDragged->view());
         }
     } else {
         // !Windows: Linux, macOS, offscreen (offscreen on Windows too), etc.
-
-        // On Linux we don't have API to check the z-order of top-levels. So first check the
-        // floating windows and check the MainWindow last, as the MainWindow will have lower z-order
-        // as it's a parent (TODO: How will it work with multiple MainWindows ?) The floating window
-        // list is sorted by z-order, as we catch QEvent::Expose and move it to last of the list
-
-        View *tlwBeingDragged = m_windowBeingDragged->floatingWindow()->view();
-        if (auto tl = qtTopLevelUnderCursor_impl(
-                globalPos, DockRegistry::self()->floatingQWindows(), tlwBeingDragged))
-            return tl;
-
-        return qtTopLevelUnderCursor_impl(
-            globalPos, DockRegistry::self()->topLevels(/*excludeFloatingDocks=*/true), tlwBeingDragged);
+        return topLevelUnderCursorByTrackedZOrder(globalPos, m_windowBeingDragged->floatingWindow()->view());
     }
 
-    KDDW_TRACE("No top-level found");
+    KDDW_CTRACE(Drag, "No top-level found");
     return nullptr;
 }
 
 static DropArea *deepestDropAreaInTopLevel(std::shared_ptr<View> topLevel, Point globalPos,
-                                           const Vector<QString> &affinities)
+                                           const AffinitySet &affinities)
 {
     const auto localPos = topLevel->mapFromGlobal(globalPos);
     auto view = topLevel->childViewAt(localPos);
 
     while (view) {
         if (auto dt = view->asDropAreaController()) {
-            if (DockRegistry::self()->affinitiesMatch(dt->affinities(), affinities))
+            if (DockRegistry::self()->affinitiesMatch(dt->affinitySet(), affinities))
                 return dt;
         }
         view = view->parentView();
@@ -1062,15 +1150,15 @@ DropArea *DragController::dropAreaUnderCursor() const
 
     std::shared_ptr<View> topLevel = qtTopLevelUnderCursor();
     if (!topLevel) {
-        KDDW_DEBUG("DragController::dropAreaUnderCursor: No drop area under cursor");
+        KDDW_CDEBUG(Drag, "DragController::dropAreaUnderCursor: No drop area under cursor");
         return nullptr;
     }
 
-    const Vector<QString> affinities = m_windowBeingDragged->floatingWindow()->affinities();
+    const AffinitySet &affinities = m_windowBeingDragged->floatingWindow()->affinitySet();
 
     if (auto fw = topLevel->asFloatingWindowController()) {
-        if (DockRegistry::self()->affinitiesMatch(fw->affinities(), affinities)) {
-            KDDW_DEBUG("DragController::dropAreaUnderCursor: Found drop area in floating window");
+        if (DockRegistry::self()->affinitiesMatch(fw->affinitySet(), affinities)) {
+            KDDW_CDEBUG(Drag, "DragController::dropAreaUnderCursor: Found drop area in floating window");
             return fw->dropArea();
         }
     }
@@ -1081,11 +1169,11 @@ DropArea *DragController::dropAreaUnderCursor() const
     }
 
     if (auto dt = deepestDropAreaInTopLevel(topLevel, Platform::instance()->cursorPos(), affinities)) {
-        KDDW_DEBUG("DragController::dropAreaUnderCursor: Found drop area {} {}", ( void * )dt, ( void * )dt->view()->rootView().get());
+        KDDW_CDEBUG(Drag, "DragController::dropAreaUnderCursor: Found drop area {} {}", ( void * )dt, ( void * )dt->view()->rootView().get());
         return dt;
     }
 
-    KDDW_DEBUG("DragController::dropAreaUnderCursor: null2");
+    KDDW_CDEBUG(Drag, "DragController::dropAreaUnderCursor: null2");
     return nullptr;
 }
 
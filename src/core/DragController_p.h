@@ -20,6 +20,7 @@
 
 #include <kdbindings/signal.h>
 
+#include <chrono>
 #include <memory>
 
 #ifdef KDDW_FRONTEND_QT_WINDOWS
@@ -153,6 +154,7 @@ private:
     friend class StateInternalMDIDragging;
     friend class StateDropped;
     friend class StateDraggingWayland;
+    friend class DelayedMouseMove;
     friend class ::TestQtWidgets;
 
     explicit DragController(Core::Object * = nullptr);
@@ -162,6 +164,10 @@ private:
     bool onMoveEvent(Core::View *) override;
     bool onMouseEvent(Core::View *, MouseEvent *) override;
 
+    /// Motion compression, see Config::setDragMotionCompression()
+    bool compressMouseMove(Point globalPos);
+    void flushPendingMouseMove();
+
     Point m_pressPos;
     Point m_offset;
 
@@ -179,6 +185,13 @@ private:
     bool m_nonClientDrag = false; // native title bar drag
     bool m_inQDrag = false; // wayland drag
     bool m_inProgrammaticDrag = false; // via DockWidget::startDrag()
+
+    Point m_pendingMovePos;
+    bool m_hasPendingMove = false;
+    std::chrono::steady_clock::time_point m_lastCompressedMove;
+
+    // Where we last hovered, see Config::setDragHoverThreshold()
+    Point m_lastHoverPos;
 };
 
 class StateBase : public State
@@ -74,6 +74,23 @@ public:
     Core::Group *const m_centralGroup = nullptr;
     Core::ItemBoxContainer *m_rootItem = nullptr;
     KDBindings::ScopedConnection m_visibleWidgetCountConnection;
+
+    /// Drop simulations done while hovering, see Config::predictiveDropPreview()
+    struct CachedDropSimulation
+    {
+        KDDockWidgets::Location location = Location_None;
+        const Core::Item *relativeTo = nullptr;
+        Size draggedSize;
+        Size draggedMinSize;
+        Size draggedMaxSize;
+        Size layoutSize;
+        DropSimulation simulation;
+    };
+
+    mutable Vector<CachedDropSimulation> m_dropSimulations;
+    KDBindings::ScopedConnection m_numItemsChangedConnection;
+    KDBindings::ScopedConnection m_numVisibleItemsChangedConnection;
+    KDBindings::ScopedConnection m_minSizeChangedConnection;
 };
 }
 
@@ -126,54 +143,43 @@ DropArea::~DropArea()
 
 Core::Group::List DropArea::groups() const
 {
-    const Core::Item::List children = d->m_rootItem->items_recursive();
-    Core::Group::List groups;
-
-    for (const Core::Item *child : children) {
-        if (auto guest = child->guest()) {
-            if (!guest->freed()) {
-                if (auto group = Group::fromItem(child)) {
-                    groups.push_back(group);
-                }
-            }
-        }
-    }
-
-    return groups;
+    return Layout::groups();
 }
 
 Core::Group *DropArea::groupContainingPos(Point globalPos) const
 {
-    const Core::Item::List &items = this->items();
-    for (Core::Item *item : items) {
-        auto group = Group::fromItem(item);
-        if (!group || !group->isVisible()) {
-            continue;
+    Core::Group *result = nullptr;
+    visitGroups([&result, globalPos](Core::Group *group) {
+        if (group->isVisible() && group->containsMouse(globalPos)) {
+            result = group;
+            return false;
         }
+        return true;
+    });
 
-        if (group->containsMouse(globalPos))
-            return group;
-    }
-    return nullptr;
+    return result;
 }
 
 void DropArea::updateFloatingActions()
 {
-    const Core::Group::List groups = this->groups();
-    for (Core::Group *group : groups)
+    visitGroups([](Core::Group *group) {
         group->updateFloatingActions();
+        return true;
+    });
 }
 
 Core::Item *DropArea::centralFrame() const
 {
-    const auto items = this->items();
-    for (Core::Item *item : items) {
-        if (auto group = Group::fromItem(item)) {
-            if (group->isCentralGroup())
-                return item;
+    Core::Item *result = nullptr;
+    visitGroups([&result](Core::Group *group) {
+        if (group->isCentralGroup()) {
+            result = group->layoutItem();
+            return false;
         }
-    }
-    return nullptr;
+        return true;
+    });
+
+    return result;
 }
 
 DropIndicatorOverlay *DropArea::dropIndicatorOverlay() const
@@ -256,8 +262,16 @@ bool DropArea::containsDockWidget(Core::DockWidget *dw) const
 
 bool DropArea::hasSingleFloatingGroup() const
 {
-    const Core::Group::List groups = this->groups();
-    return groups.size() == 1 && groups.first()->isFloating();
+    if (groupCount() != 1)
+        return false;
+
+    bool isFloating = false;
+    visitGroups([&isFloating](Core::Group *group) {
+        isFloating = group->isFloating();
+        return false;
+    });
+
+    return isFloating;
 }
 
 bool DropArea::hasSingleGroup() const
@@ -266,14 +280,20 @@ bool DropArea::hasSingleGroup() const
 }
 
 Vector<QString> DropArea::affinities() const
+{
+    return affinitySet().names;
+}
+
+const AffinitySet &DropArea::affinitySet() const
 {
     if (auto mw = mainWindow()) {
-        return mw->affinities();
+        return mw->affinitySet();
     } else if (auto fw = floatingWindow()) {
-        return fw->affinities();
+        return fw->affinitySet();
     }
 
-    return {};
+    static const AffinitySet s_noAffinities;
+    return s_noAffinities;
 }
 
 void DropArea::layoutParentContainerEqually(Core::DockWidget *dw)
@@ -306,6 +326,16 @@ DropLocation DropArea::hover(WindowBeingDragged *draggedWindow, Point globalPos)
     return d->m_dropIndicatorOverlay->hover(globalPos);
 }
 
+bool DropArea::isHoveringSameSegment(Point globalPos) const
+{
+    if (!d->m_dropIndicatorOverlay || d->m_dropIndicatorOverlay->currentDropLocation() == DropLocation_None)
+        return false;
+
+    // Also compare the indicator/segment, as a small motion can cross into a neighbouring one
+    return groupContainingPos(globalPos) == d->m_dropIndicatorOverlay->hoveredGroup()
+        && d->m_dropIndicatorOverlay->dropLocationAt(globalPos) == d->m_dropIndicatorOverlay->currentDropLocation();
+}
+
 static bool isOutterLocation(DropLocation location)
 {
     switch (location) {
@@ -330,11 +360,11 @@ bool DropArea::drop(WindowBeingDragged *droppedWindow, Point globalPos)
     }
 
     if (d->m_dropIndicatorOverlay->currentDropLocation() == DropLocation_None) {
-        KDDW_DEBUG("DropArea::drop: bailing out, drop location = none");
+        KDDW_CDEBUG(Drag, "DropArea::drop: bailing out, drop location = none");
         return false;
     }
 
-    KDDW_DEBUG("DropArea::drop: {}", ( void * )droppedWindow);
+    KDDW_CDEBUG(Drag, "DropArea::drop: {}", ( void * )droppedWindow);
 
     hover(droppedWindow, globalPos);
     auto droploc = d->m_dropIndicatorOverlay->currentDropLocation();
@@ -393,7 +423,7 @@ bool DropArea::drop(WindowBeingDragged *draggedWindow, Core::Group *acceptingGro
                       DropIndicatorOverlay::multisplitterLocationFor(droploc), nullptr);
         break;
     case DropLocation_Center:
-        KDDW_DEBUG("Tabbing window={} into group={}", ( void * )droppedWindow, ( void * )acceptingGroup);
+        KDDW_CDEBUG(Drag, "Tabbing window={} into group={}", ( void * )droppedWindow, ( void * )acceptingGroup);
 
         if (!validateAffinity(droppedWindow, acceptingGroup))
             return false;
@@ -436,7 +466,7 @@ bool DropArea::drop(WindowBeingDragged *draggedWindow, Core::Group *acceptingGro
 bool DropArea::drop(View *droppedWindow, KDDockWidgets::Location location,
                     Core::Group *relativeTo)
 {
-    KDDW_DEBUG("DropArea::drop");
+    KDDW_CDEBUG(Drag, "DropArea::drop");
 
     if (auto dock = droppedWindow->asDockWidgetController()) {
         if (!validateAffinity(dock))
@@ -445,11 +475,15 @@ bool DropArea::drop(View *droppedWindow, KDDockWidgets::Location location,
         auto group = new Core::Group();
         group->addTab(dock);
         Item *relativeToItem = relativeTo ? relativeTo->layoutItem() : nullptr;
+
+        // With predictive drop preview, guests are only resized once, after the relayout is done
+        DeferredGuestGeometry deferredGeometry(Config::self().predictiveDropPreview() ? d->m_rootItem : nullptr);
         addWidget(group->view(), location, relativeToItem, DefaultSizeMode::FairButFloor);
     } else if (auto floatingWindow = droppedWindow->asFloatingWindowController()) {
         if (!validateAffinity(floatingWindow))
             return false;
 
+        DeferredGuestGeometry deferredGeometry(Config::self().predictiveDropPreview() ? d->m_rootItem : nullptr);
         addMultiSplitter(floatingWindow->dropArea(), location, relativeTo,
                          DefaultSizeMode::FairButFloor);
 
@@ -465,21 +499,22 @@ bool DropArea::drop(View *droppedWindow, KDDockWidgets::Location location,
 
 void DropArea::removeHover()
 {
+    d->m_dropSimulations.clear();
     d->m_dropIndicatorOverlay->removeHover();
 }
 
 template<typename T>
 bool DropArea::validateAffinity(T *window, Core::Group *acceptingGroup) const
 {
-    if (!DockRegistry::self()->affinitiesMatch(window->affinities(), affinities())) {
+    if (!DockRegistry::self()->affinitiesMatch(window->affinitySet(), affinitySet())) {
         return false;
     }
 
     if (acceptingGroup) {
         // We're dropping into another group (as tabbed), so also check the affinity of the group
         // not only of the main window, which might be more forgiving
-        if (!DockRegistry::self()->affinitiesMatch(window->affinities(),
-                                                   acceptingGroup->affinities())) {
+        if (!DockRegistry::self()->affinitiesMatch(window->affinitySet(),
+                                                   acceptingGroup->affinitySet())) {
             return false;
         }
     }
@@ -634,7 +669,7 @@ void DropArea::addWidget(View *w, Location location, Core::Item *relativeToItem,
 void DropArea::addMultiSplitter(Core::DropArea *sourceMultiSplitter, Location location,
                                 Core::Group *relativeToGroup, const InitialOption &option)
 {
-    KDDW_DEBUG("DropArea::addMultiSplitter: {} {} {}", ( void * )sourceMultiSplitter, ( int )location, ( void * )relativeToGroup);
+    KDDW_CDEBUG(Layouting, "DropArea::addMultiSplitter: {} {} {}", ( void * )sourceMultiSplitter, ( int )location, ( void * )relativeToGroup);
     Item *relativeToItem = relativeToGroup ? relativeToGroup->layoutItem() : nullptr;
 
     addWidget(sourceMultiSplitter->view(), location, relativeToItem, option);
@@ -682,6 +717,13 @@ void DropArea::setRootItem(Core::ItemBoxContainer *root)
 {
     Layout::setRootItem(root);
     d->m_rootItem = root;
+    d->m_dropSimulations.clear();
+
+    // Any structural change invalidates the simulations done while hovering
+    auto clearSimulations = [this] { d->m_dropSimulations.clear(); };
+    d->m_numItemsChangedConnection = root->numItemsChanged.connect(clearSimulations);
+    d->m_numVisibleItemsChangedConnection = root->numVisibleItemsChanged.connect(clearSimulations);
+    d->m_minSizeChangedConnection = root->minSizeChanged.connect(clearSimulations);
 }
 
 Core::ItemBoxContainer *DropArea::rootItem() const
@@ -692,18 +734,53 @@ Core::ItemBoxContainer *DropArea::rootItem() const
 Rect DropArea::rectForDrop(const WindowBeingDragged *wbd, Location location,
                            const Core::Item *relativeTo) const
 {
-    Core::Item item(nullptr);
+    return simulateDrop(wbd, location, relativeTo).dropRect;
+}
+
+DropSimulation DropArea::simulateDrop(const WindowBeingDragged *wbd, Location location,
+                                      const Core::Item *relativeTo) const
+{
     if (!wbd)
         return {};
 
-    item.setSize(wbd->size().boundedTo(wbd->maxSize()));
-    item.setMinSize(wbd->minSize());
-    item.setMaxSizeHint(wbd->maxSize());
+    const Size draggedSize = wbd->size().boundedTo(wbd->maxSize());
+    const Size draggedMinSize = wbd->minSize();
+    const Size draggedMaxSize = wbd->maxSize();
+    const Size layoutSize = this->layoutSize();
+
+    const bool useCache = Config::self().predictiveDropPreview();
+    if (useCache) {
+        for (const auto &cached : std::as_const(d->m_dropSimulations)) {
+            if (cached.location == location && cached.relativeTo == relativeTo
+                && cached.draggedSize == draggedSize && cached.draggedMinSize == draggedMinSize
+                && cached.draggedMaxSize == draggedMaxSize && cached.layoutSize == layoutSize)
+                return cached.simulation;
+        }
+    }
+
+    Core::Item item(nullptr);
+    item.setSize(draggedSize);
+    item.setMinSize(draggedMinSize);
+    item.setMaxSizeHint(draggedMaxSize);
 
     Core::ItemBoxContainer *container =
         relativeTo ? relativeTo->parentBoxContainer() : d->m_rootItem;
 
-    return container->suggestedDropRect(&item, relativeTo, location);
+    DropSimulation simulation = container->simulateDrop(&item, relativeTo, location);
+
+    if (useCache) {
+        Private::CachedDropSimulation cached;
+        cached.location = location;
+        cached.relativeTo = relativeTo;
+        cached.draggedSize = draggedSize;
+        cached.draggedMinSize = draggedMinSize;
+        cached.draggedMaxSize = draggedMaxSize;
+        cached.layoutSize = layoutSize;
+        cached.simulation = simulation;
+        d->m_dropSimulations.push_back(cached);
+    }
+
+    return simulation;
 }
 
 bool DropArea::deserialize(const LayoutSaver::MultiSplitter &l)
@@ -38,6 +38,7 @@ class Separator;
 class DropIndicatorOverlay;
 class LayoutingSeparator;
 struct WindowBeingDragged;
+struct DropSimulation;
 
 /**
  * MultiSplitter is simply a wrapper around Core::Item in which the hosted widgets are
@@ -82,6 +83,10 @@ public:
     bool hasSingleGroup() const;
 
     Vector<QString> affinities() const;
+
+    /// @internal
+    /// @brief Returns the affinities, interned for matching
+    const AffinitySet &affinitySet() const;
     void layoutParentContainerEqually(DockWidget *);
 
     /// When DockWidgetOption_MDINestable is used, docked MDI dock widgets will be wrapped inside
@@ -120,6 +125,12 @@ public:
     Rect rectForDrop(const WindowBeingDragged *wbd, KDDockWidgets::Location location,
                      const Core::Item *relativeTo) const;
 
+    /// Like rectForDrop() but also tells whether the simulation was exact.
+    /// If Config::predictiveDropPreview() is enabled, the result is cached until the hover ends
+    /// or the layout changes.
+    DropSimulation simulateDrop(const WindowBeingDragged *wbd, KDDockWidgets::Location location,
+                                const Core::Item *relativeTo) const;
+
     bool deserialize(const LayoutSaver::MultiSplitter &) override;
 
     ///@brief returns the list of separators
@@ -140,6 +151,10 @@ public:
     /// Returns the current drop location
     /// The user needs to be dragging a window and be over a drop indicator, otherwise DropLocation_None is returned
     DropLocation currentDropLocation() const;
+
+    /// @brief Returns whether hovering @p globalPos would keep the current hovered group and drop
+    /// location. Only a cheap approximation, for skipping hover work on small mouse moves.
+    bool isHoveringSameSegment(Point globalPos) const;
 #if defined(DOCKS_DEVELOPER_MODE) || defined(KDDW_FRONTEND_FLUTTER)
 public:
 #else
@@ -187,8 +187,8 @@ bool DropIndicatorOverlay::dropIndicatorVisible(DropLocation dropLoc) const
             return false;
 
         // Only allow to dock to center if the affinities match
-        if (!DockRegistry::self()->affinitiesMatch(m_hoveredGroup->affinities(),
-                                                   windowBeingDragged->affinities()))
+        if (!DockRegistry::self()->affinitiesMatch(m_hoveredGroup->affinitySet(),
+                                                   windowBeingDragged->affinitySet()))
             return false;
     } else {
         KDDW_ERROR("Unknown drop indicator location={}", dropLoc);
@@ -233,6 +233,11 @@ DropLocation DropIndicatorOverlay::hover(Point globalPos)
     return loc;
 }
 
+DropLocation DropIndicatorOverlay::dropLocationAt(Point) const
+{
+    return DropLocation_None;
+}
+
 void DropIndicatorOverlay::setHoveredGroupRect(Rect rect)
 {
     if (m_hoveredGroupRect != rect) {
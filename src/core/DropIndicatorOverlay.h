@@ -60,6 +60,10 @@ public:
 
     KDDockWidgets::DropLocation hover(Point globalPos);
 
+    /// @brief Returns the drop location under @p globalPos, without hovering it
+    /// Returns DropLocation_None if unknown, in which case callers should do a full hover()
+    virtual DropLocation dropLocationAt(Point globalPos) const;
+
     /// Clears and hides drop indicators
     void removeHover();
 
@@ -22,6 +22,7 @@
 #include "core/Controller_p.h"
 #include "core/WidgetResizeHandler_p.h"
 #include "DockRegistry.h"
+#include "DockRegistry_p.h"
 #include "Config.h"
 #include "Layout_p.h"
 #include "core/ViewFactory.h"
@@ -121,12 +122,12 @@ static MainWindow *hackFindParentHarder(Core::Group *group, MainWindow *candidat
     if (windows.size() == 1)
         return windows.first();
 
-    const Vector<QString> affinities = group ? group->affinities() : Vector<QString>();
+    const AffinitySet affinities = group ? group->affinitySet() : AffinitySet();
     const MainWindow::List mainWindows =
         DockRegistry::self()->mainWindowsWithAffinity(affinities);
 
     if (mainWindows.isEmpty()) {
-        KDDW_ERROR("No window with affinity={} found", affinities, "found");
+        KDDW_ERROR("No window with affinity={} found", affinities.names, "found");
         return nullptr;
     }
 
@@ -151,7 +152,7 @@ FloatingWindow::FloatingWindow(Rect suggestedGeometry, MainWindow *parent,
                                                                 // Otherwise the
                                                                 // KDDockWidgets::TitleBar is the
                                                                 // draggable
-    , d(new Private(requestedFlags, this))
+    , d(new Private(requestedFlags, actualParent(parent), this))
     , m_titleBar(new Core::TitleBar(this))
 {
     view()->init();
@@ -197,7 +198,10 @@ FloatingWindow::FloatingWindow(Rect suggestedGeometry, MainWindow *parent,
 
     view()->d->layoutInvalidated.connect([this] { updateSizeConstraints(); });
 
-    d->m_layoutDestroyedConnection = d->m_dropArea->Controller::dptr()->aboutToBeDeleted.connect(&FloatingWindow::scheduleDeleteLater, this);
+    d->m_layoutDestroyedConnection = d->m_dropArea->Controller::dptr()->aboutToBeDeleted.connect([this] {
+        d->m_layoutDestroyed = true;
+        scheduleDeleteLater();
+    });
 
     d->numGroupsChanged.connect([this] {
         d->numDockWidgetsChanged.emit();
@@ -207,6 +211,33 @@ FloatingWindow::FloatingWindow(Rect suggestedGeometry, MainWindow *parent,
 FloatingWindow::FloatingWindow(Core::Group *group, Rect suggestedGeometry,
                                MainWindow *parent)
     : FloatingWindow({}, hackFindParentHarder(group, parent), floatingWindowFlagsForGroup(group))
+{
+    adoptGroup(group, suggestedGeometry);
+}
+
+FloatingWindow *FloatingWindow::create(Core::Group *group, Rect suggestedGeometry,
+                                       MainWindow *parent)
+{
+    auto &pool = DockRegistry::self()->dptr()->m_floatingWindowPool;
+    if (!pool.isEmpty()) {
+        MainWindow *actualParentWindow = actualParent(hackFindParentHarder(group, parent));
+        const FloatingWindowFlags requestedFlags = floatingWindowFlagsForGroup(group);
+        for (FloatingWindow *fw : std::as_const(pool)) {
+            if (fw->d->canReuse(actualParentWindow, requestedFlags)) {
+                pool.removeOne(fw);
+                fw->d->m_pooled = false;
+                fw->m_deleteScheduled = false;
+                DockRegistry::self()->registerFloatingWindow(fw);
+                fw->adoptGroup(group, suggestedGeometry);
+                return fw;
+            }
+        }
+    }
+
+    return new FloatingWindow(group, suggestedGeometry, parent);
+}
+
+void FloatingWindow::adoptGroup(Core::Group *group, Rect suggestedGeometry)
 {
     ScopedValueRollback guard(m_disableSetVisible, true);
 
@@ -311,9 +342,8 @@ std::unique_ptr<WindowBeingDragged> FloatingWindow::makeWindow()
 
 Core::DockWidget *FloatingWindow::singleDockWidget() const
 {
-    const Core::Group::List groups = this->groups();
-    if (groups.size() == 1) {
-        Core::Group *group = groups.first();
+    if (d->m_dropArea->groupCount() == 1) {
+        Core::Group *group = singleFrame();
         if (group->hasSingleDockWidget())
             return group->dockWidgetAt(0);
     }
@@ -341,13 +371,12 @@ Size FloatingWindow::maxSizeHint() const
         return result;
     }
 
-    const Core::Group::List groups = this->groups();
-    if (groups.size() == 1) {
+    if (d->m_dropArea->groupCount() == 1) {
         // Let's honour max-size when we have a single-group.
         // multi-group cases are more complicated and we're not sure if we want the window to
         // bounce around. single-group is the most common case, like floating a dock widget, so
         // let's do that first, it's also easy.
-        Core::Group *group = groups[0];
+        Core::Group *group = singleFrame();
         if (group->dockWidgetCount() == 1) { // We don't support if there's tabbing
             const Size waste =
                 (view()->minSize() - group->view()->minSize()).expandedTo(Size(0, 0));
@@ -388,12 +417,38 @@ void FloatingWindow::setSuggestedGeometry(Rect suggestedRect, SuggestedGeometryH
 
 void FloatingWindow::scheduleDeleteLater()
 {
+    if (d->m_pooled)
+        return;
+
     m_deleteScheduled = true;
+
+    if (d->canRecycle()) {
+        recycle();
+        return;
+    }
+
     view()->d->setAboutToBeDestroyed();
     DockRegistry::self()->unregisterFloatingWindow(this);
     destroyLater();
 }
 
+void FloatingWindow::recycle()
+{
+    // The window stays alive, hidden, so the next detach doesn't need to create a native window.
+    // beingDeleted() keeps returning true while pooled, as for any other code this window is gone.
+    d->m_pooled = true;
+    DockRegistry::self()->unregisterFloatingWindow(this);
+
+    // Remove any placeholders, dock widgets shouldn't remember a position in a pooled window
+    d->m_dropArea->clearLayout();
+    setVisible(false);
+
+    // Max-size was honouring the previous contents
+    view()->setMaximumSize(Core::Item::hardcodedMaximumSize);
+
+    DockRegistry::self()->dptr()->m_floatingWindowPool.push_back(this);
+}
+
 Core::DropArea *FloatingWindow::multiSplitter() const
 {
     return d->m_dropArea;
@@ -419,22 +474,22 @@ bool FloatingWindow::isInDragArea(Point globalPoint) const
 
 bool FloatingWindow::anyNonClosable() const
 {
-    const auto groups = this->groups();
-    for (Core::Group *group : groups) {
-        if (group->anyNonClosable())
-            return true;
-    }
-    return false;
+    bool result = false;
+    d->m_dropArea->visitGroups([&result](Core::Group *group) {
+        result = group->anyNonClosable();
+        return !result;
+    });
+    return result;
 }
 
 bool FloatingWindow::anyNonDockable() const
 {
-    const auto groups = this->groups();
-    for (Core::Group *group : groups) {
-        if (group->anyNonDockable())
-            return true;
-    }
-    return false;
+    bool result = false;
+    d->m_dropArea->visitGroups([&result](Core::Group *group) {
+        result = group->anyNonDockable();
+        return !result;
+    });
+    return result;
 }
 
 bool FloatingWindow::hasSingleGroup() const
@@ -444,18 +499,20 @@ bool FloatingWindow::hasSingleGroup() const
 
 bool FloatingWindow::hasSingleDockWidget() const
 {
-    const Core::Group::List groups = this->groups();
-    if (groups.size() != 1)
+    if (d->m_dropArea->groupCount() != 1)
         return false;
 
-    Core::Group *group = groups.first();
-    return group->dockWidgetCount() == 1;
+    return singleFrame()->dockWidgetCount() == 1;
 }
 
 Core::Group *FloatingWindow::singleFrame() const
 {
-    const Core::Group::List groups = this->groups();
-    return groups.isEmpty() ? nullptr : groups.first();
+    Core::Group *result = nullptr;
+    d->m_dropArea->visitGroups([&result](Core::Group *group) {
+        result = group;
+        return false;
+    });
+    return result;
 }
 
 bool FloatingWindow::beingDeleted() const
@@ -463,13 +520,12 @@ bool FloatingWindow::beingDeleted() const
     if (m_deleteScheduled || m_inDtor)
         return true;
 
-    const auto groups = this->groups();
-    for (Core::Group *f : groups) {
-        if (f->beingDeletedLater())
-            return true;
-    }
-
-    return false;
+    bool result = false;
+    d->m_dropArea->visitGroups([&result](Core::Group *group) {
+        result = group->beingDeletedLater();
+        return !result;
+    });
+    return result;
 }
 
 void FloatingWindow::onFrameCountChanged(int count)
@@ -515,15 +571,16 @@ void FloatingWindow::updateTitleBarVisibility()
 
     bool visible = true;
 
-    const auto groups = this->groups();
-    for (Core::Group *group : groups)
+    d->m_dropArea->visitGroups([](Core::Group *group) {
         group->updateTitleBarVisibility();
+        return true;
+    });
 
     if (KDDockWidgets::usesClientTitleBar()) {
         if ((d->m_flags & FloatingWindowFlag::HideTitleBarWhenTabsVisible)
             && !(d->m_flags & FloatingWindowFlag::AlwaysTitleBarWhenFloating)) {
             if (hasSingleGroup()) {
-                visible = !groups.first()->hasTabsVisible();
+                visible = !singleFrame()->hasTabsVisible();
             }
         }
 
@@ -537,8 +594,16 @@ void FloatingWindow::updateTitleBarVisibility()
 
 Vector<QString> FloatingWindow::affinities() const
 {
-    auto groups = this->groups();
-    return groups.isEmpty() ? Vector<QString>() : groups.constFirst()->affinities();
+    return affinitySet().names;
+}
+
+const AffinitySet &FloatingWindow::affinitySet() const
+{
+    if (const Core::Group *group = singleFrame())
+        return group->affinitySet();
+
+    static const AffinitySet s_noAffinities;
+    return s_noAffinities;
 }
 
 void FloatingWindow::updateTitleAndIcon()
@@ -546,7 +611,7 @@ void FloatingWindow::updateTitleAndIcon()
     QString title;
     Icon icon;
     if (hasSingleGroup()) {
-        const Core::Group *group = groups().constFirst();
+        const Core::Group *group = singleFrame();
         title = group->title();
         icon = group->icon();
     } else {
@@ -632,7 +697,7 @@ Rect FloatingWindow::dragRect() const
         rect = m_titleBar->rect();
         rect.moveTopLeft(m_titleBar->view()->mapToGlobal(Point(0, 0)));
     } else if (hasSingleGroup()) {
-        rect = groups().constFirst()->dragRect();
+        rect = singleFrame()->dragRect();
     } else {
         KDDW_ERROR("Expected a title bar");
     }
@@ -642,34 +707,42 @@ Rect FloatingWindow::dragRect() const
 
 bool FloatingWindow::allDockWidgetsHave(DockWidgetOption option) const
 {
-    const Core::Group::List groups = this->groups();
-    return std::all_of(groups.begin(), groups.end(), [option](Core::Group *group) {
-        return group->allDockWidgetsHave(option);
+    bool result = true;
+    d->m_dropArea->visitGroups([&result, option](Core::Group *group) {
+        result = group->allDockWidgetsHave(option);
+        return result;
     });
+    return result;
 }
 
 bool FloatingWindow::anyDockWidgetsHas(DockWidgetOption option) const
 {
-    const Core::Group::List groups = this->groups();
-    return std::any_of(groups.begin(), groups.end(), [option](Core::Group *group) {
-        return group->anyDockWidgetsHas(option);
+    bool result = false;
+    d->m_dropArea->visitGroups([&result, option](Core::Group *group) {
+        result = group->anyDockWidgetsHas(option);
+        return !result;
     });
+    return result;
 }
 
 bool FloatingWindow::allDockWidgetsHave(LayoutSaverOption option) const
 {
-    const Core::Group::List groups = this->groups();
-    return std::all_of(groups.begin(), groups.end(), [option](Core::Group *group) {
-        return group->allDockWidgetsHave(option);
+    bool result = true;
+    d->m_dropArea->visitGroups([&result, option](Core::Group *group) {
+        result = group->allDockWidgetsHave(option);
+        return result;
     });
+    return result;
 }
 
 bool FloatingWindow::anyDockWidgetsHas(LayoutSaverOption option) const
 {
-    const Core::Group::List groups = this->groups();
-    return std::any_of(groups.begin(), groups.end(), [option](Core::Group *group) {
-        return group->anyDockWidgetsHas(option);
+    bool result = false;
+    d->m_dropArea->visitGroups([&result, option](Core::Group *group) {
+        result = group->anyDockWidgetsHas(option);
+        return !result;
     });
+    return result;
 }
 
 void FloatingWindow::addDockWidget(Core::DockWidget *dw, Location location,
@@ -800,11 +873,11 @@ FloatingWindow::Private *FloatingWindow::dptr() const
 
 void FloatingWindow::focus(Qt::FocusReason reason)
 {
-    const auto groups = this->groups();
-    if (groups.isEmpty())
+    Core::Group *group = singleFrame();
+    if (!group)
         return; // doesn't really happen
 
-    groups.constFirst()->focus(reason);
+    group->focus(reason);
 }
 
 inline FloatingWindowFlags flagsForFloatingWindow(FloatingWindowFlags requestedFlags)
@@ -846,8 +919,33 @@ inline FloatingWindowFlags flagsForFloatingWindow(FloatingWindowFlags requestedF
     return flags;
 }
 
-FloatingWindow::Private::Private(FloatingWindowFlags requestedFlags, FloatingWindow *q)
+FloatingWindow::Private::Private(FloatingWindowFlags requestedFlags, MainWindow *parent,
+                                 FloatingWindow *qq)
     : m_flags(flagsForFloatingWindow(requestedFlags))
-    , m_dropArea(new DropArea(q->view(), MainWindowOption_None))
+    , m_windowFlags(windowFlagsToUse(requestedFlags))
+    , m_parent(parent)
+    , m_dropArea(new DropArea(qq->view(), MainWindowOption_None))
+    , q(qq)
+{
+}
+
+bool FloatingWindow::Private::canRecycle() const
+{
+    if (m_layoutDestroyed || q->m_inDtor || !m_dropArea)
+        return false;
+
+    const int poolSize = Config::self().floatingWindowPoolSize();
+    if (poolSize <= 0 || DockRegistry::self()->dptr()->m_floatingWindowPool.size() >= poolSize)
+        return false;
+
+    // Only empty windows in normal state. Maximized or minimized would need a roundtrip
+    // with the window manager when reused.
+    return m_dropArea->groups().isEmpty() && !q->view()->isMaximized()
+        && !q->view()->isMinimized();
+}
+
+bool FloatingWindow::Private::canReuse(MainWindow *parent, FloatingWindowFlags requestedFlags) const
 {
+    return m_parent.data() == parent && m_flags == flagsForFloatingWindow(requestedFlags)
+        && m_windowFlags == windowFlagsToUse(requestedFlags);
 }
@@ -120,9 +120,20 @@ public:
 
     /**
      * @brief Equivalent to deleteLater() but sets beingDeleted() to true
+     * If Config::floatingWindowPoolSize() is set and the pool isn't full, the empty window is
+     * hidden and kept for reuse by create() instead.
      */
     void scheduleDeleteLater();
 
+    /**
+     * @brief Returns a floating window hosting @p group
+     * Reuses a pooled window if there's one with the same parent and flags, otherwise creates one.
+     * Like the constructor, the window isn't shown.
+     * @sa Config::setFloatingWindowPoolSize()
+     */
+    static FloatingWindow *create(Core::Group *group, Rect suggestedGeometry = {},
+                                  MainWindow *parent = nullptr);
+
     /**
      * @brief Returns the MultiSplitter
      */
@@ -147,6 +158,10 @@ public:
 
     Vector<QString> affinities() const;
 
+    /// @internal
+    /// @brief Returns the affinities, interned for matching
+    const AffinitySet &affinitySet() const;
+
     /**
      * Returns the drag rect in global coordinates. This is usually the title bar rect.
      * However, when using Config::Flag_HideTitleBarWhenTabsVisible it will be the tab bar
@@ -219,6 +234,8 @@ private:
     void onVisibleFrameCountChanged(int count);
     void onCloseEvent(CloseEvent *);
     void updateSizeConstraints();
+    void adoptGroup(Core::Group *group, Rect suggestedGeometry);
+    void recycle();
 
     bool m_disableSetVisible = false;
     bool m_deleteScheduled = false;
@@ -0,0 +1,93 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include <list>
+#include <unordered_map>
+
+namespace KDDockWidgets {
+
+namespace Core {
+
+class FloatingWindow;
+
+/// @brief Tracks the stacking order of the floating windows
+///
+/// Windows are added on top when registered and moved to the top whenever they're raised,
+/// activated or exposed. All updates are O(1).
+/// Used by platforms that can't query the window manager for the z-order, so drag target lookups
+/// can iterate front to back without reshuffling DockRegistry's list.
+class FloatingWindowZOrder
+{
+public:
+    /// Ordered from back to front
+    using List = std::list<FloatingWindow *>;
+
+    /// @brief Adds @p fw on top. Does nothing if already tracked.
+    void add(FloatingWindow *fw)
+    {
+        if (m_iterators.find(fw) != m_iterators.end())
+            return;
+
+        m_iterators[fw] = m_windows.insert(m_windows.end(), fw);
+    }
+
+    void remove(FloatingWindow *fw)
+    {
+        auto it = m_iterators.find(fw);
+        if (it == m_iterators.end())
+            return;
+
+        m_windows.erase(it->second);
+        m_iterators.erase(it);
+    }
+
+    /// @brief Moves @p fw to the top. Does nothing if not tracked.
+    void raise(FloatingWindow *fw)
+    {
+        auto it = m_iterators.find(fw);
+        if (it == m_iterators.end())
+            return;
+
+        m_windows.splice(m_windows.end(), m_windows, it->second);
+    }
+
+    bool contains(FloatingWindow *fw) const
+    {
+        return m_iterators.find(fw) != m_iterators.end();
+    }
+
+    FloatingWindow *topMost() const
+    {
+        return m_windows.empty() ? nullptr : m_windows.back();
+    }
+
+    /// @brief Returns the windows, ordered from back to front
+    /// Iterate in reverse for a front to back traversal.
+    const List &windows() const
+    {
+        return m_windows;
+    }
+
+    int size() const
+    {
+        return int(m_windows.size());
+    }
+
+private:
+    List m_windows;
+    std::unordered_map<const FloatingWindow *, List::iterator> m_iterators;
+};
+
+}
+
+}
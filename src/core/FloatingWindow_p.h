@@ -25,7 +25,14 @@ namespace Core {
 class FloatingWindow::Private
 {
 public:
-    explicit Private(FloatingWindowFlags requestedFlags, FloatingWindow *q);
+    explicit Private(FloatingWindowFlags requestedFlags, MainWindow *parent, FloatingWindow *qq);
+
+    /// @brief Returns whether this empty window can be hidden and put in the pool, instead of deleted
+    bool canRecycle() const;
+
+    /// @brief Returns whether this pooled window can be reused for a window with the specified
+    /// parent and requested flags
+    bool canReuse(MainWindow *parent, FloatingWindowFlags requestedFlags) const;
 
     KDBindings::Signal<> activatedChanged;
     KDBindings::Signal<> numGroupsChanged;
@@ -37,8 +44,13 @@ public:
     KDBindings::ScopedConnection m_layoutDestroyedConnection;
 
     const FloatingWindowFlags m_flags;
+    const Qt::WindowFlags m_windowFlags;
+    const ObjectGuard<MainWindow> m_parent;
     ObjectGuard<DropArea> m_dropArea;
     bool m_minimizationPending = false;
+    bool m_layoutDestroyed = false;
+    bool m_pooled = false;
+    FloatingWindow *const q;
 };
 
 }
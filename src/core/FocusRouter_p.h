@@ -0,0 +1,83 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "kddockwidgets/core/View.h"
+
+#include <kdbindings/signal.h>
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace KDDockWidgets {
+
+class DockRegistry;
+
+namespace Core {
+
+class DockWidget;
+class FocusScope;
+
+/// @brief Routes focus changes to the FocusScopes and to DockRegistry
+///
+/// Resolves the focused view's parent chain once per focus change, instead of once per FocusScope.
+/// Only the scopes which gain or lose focus are notified.
+/// Owned by Platform, so it outlives every scope and the DockRegistry singleton.
+class FocusRouter
+{
+public:
+    /// @brief Registers @p scope, whose view is @p handle
+    void addScope(FocusScope *scope, HANDLE handle);
+    void removeScope(FocusScope *scope, HANDLE handle);
+
+    /// @brief DockRegistry gets told which dock widget is focused, if it exists
+    void setDockRegistry(DockRegistry *);
+
+    void onFocusedViewChanged(std::shared_ptr<View> view);
+
+    KDBindings::ScopedConnection m_connection;
+
+private:
+    using ScopeList = std::vector<std::pair<HANDLE, FocusScope *>>;
+
+    struct Resolution
+    {
+        /// The scopes whose view is the focused view or one of its ancestors
+        ScopeList scopes;
+
+        /// The dock widget containing the focused view.
+        /// Not set if the focused view is in a Group without current dock widget, in which case
+        /// the focused dock widget doesn't change.
+        DockWidget *dockWidget = nullptr;
+        bool hasDockWidget = true;
+    };
+
+    /// @brief Walks the parent chain of @p view once, resolving its scopes and dock widget
+    Resolution resolve(std::shared_ptr<View> view) const;
+
+    /// @brief Returns whether @p scope wasn't removed meanwhile
+    bool isRegistered(HANDLE, FocusScope *scope) const;
+
+    /// The registered scopes, by the handle of their view
+    std::unordered_map<HANDLE, FocusScope *> m_scopesByHandle;
+
+    /// The scopes containing the focused view
+    ScopeList m_focusedScopes;
+
+    DockRegistry *m_dockRegistry = nullptr;
+};
+
+}
+
+}
@@ -17,6 +17,7 @@
  */
 
 #include "FocusScope.h"
+#include "FocusRouter_p.h"
 #include "Platform.h"
 #include "ViewGuard.h"
 #include "core/DockWidget.h"
@@ -28,6 +29,8 @@
 #include "View.h"
 #include "core/views/DockWidgetViewInterface.h"
 
+#include <algorithm>
+
 using namespace KDDockWidgets;
 using namespace KDDockWidgets::Core;
 
@@ -37,14 +40,8 @@ public:
     Private(FocusScope *qq, View *thisView)
         : q(qq)
         , m_thisView(thisView)
+        , m_handle(thisView->handle())
     {
-        auto plat = Platform::instance();
-        m_connection = plat->d->focusedViewChanged.connect(&Private::onFocusedViewChanged, this);
-
-        onFocusedViewChanged(plat->focusedView());
-
-        // NOLINTNEXTLINE(cppcoreguidelines-prefer-member-initializer)
-        m_inCtor = false;
     }
 
     /// @brief Returns whether the last focused widget is the tab widget itself
@@ -57,25 +54,34 @@ public:
     ~Private();
 
     void setIsFocused(bool);
+
+    /// @brief Called by FocusRouter when @p view, which is inside this scope, gets focus
     void onFocusedViewChanged(std::shared_ptr<View> view);
-    bool isInFocusScope(std::shared_ptr<View> view) const;
+
+    /// @brief Called by FocusRouter when the focused view isn't inside this scope anymore
+    void onFocusLost();
 
     FocusScope *const q;
     ViewGuard m_thisView;
+    const HANDLE m_handle;
     bool m_isFocused = false;
     bool m_inCtor = true;
     std::shared_ptr<View> m_lastFocusedInScope;
-    KDBindings::ConnectionHandle m_connection;
+    int m_numFocusNotifications = 0;
 };
 
 FocusScope::Private::~Private()
 {
-    m_connection.disconnect();
+    if (Platform::hasInstance())
+        Platform::instance()->d->m_focusRouter.removeScope(q, m_handle);
 }
 
 FocusScope::FocusScope(View *thisView)
     : d(new Private(this, thisView))
 {
+    // Not from Private's ctor, as the router might call back into d right away
+    Platform::instance()->d->m_focusRouter.addScope(this, d->m_handle);
+    d->m_inCtor = false;
 }
 
 FocusScope::~FocusScope()
@@ -88,6 +94,13 @@ bool FocusScope::isFocused() const
     return d->m_isFocused;
 }
 
+#ifdef DOCKS_DEVELOPER_MODE
+int FocusScope::numFocusNotifications() const
+{
+    return d->m_numFocusNotifications;
+}
+#endif
+
 void FocusScope::focus(Qt::FocusReason reason)
 {
     // Note: For QtQuick, qGuiApp->focusObject().isVisible() can be false! Because QtQuick.
@@ -104,23 +117,23 @@ void FocusScope::focus(Qt::FocusReason reason)
                 if (auto dwView = dynamic_cast<Core::DockWidgetViewInterface *>(dw->view())) {
                     if (auto candidate = dwView->focusCandidate()) {
                         if (candidate->focusPolicy() != Qt::NoFocus) {
-                            KDDW_DEBUG("FocusScope::focus: Setting focus on candidate!");
+                            KDDW_CDEBUG(Focus, "FocusScope::focus: Setting focus on candidate!");
                             candidate->setFocus(reason);
                         } else {
-                            KDDW_DEBUG("FocusScope::focus: Candidate has no focus policy");
+                            KDDW_CDEBUG(Focus, "FocusScope::focus: Candidate has no focus policy");
                         }
                     } else {
-                        KDDW_DEBUG("FocusScope::focus: Candidate not found");
+                        KDDW_CDEBUG(Focus, "FocusScope::focus: Candidate not found");
                     }
                 } else {
-                    KDDW_DEBUG("FocusScope::focus: Dw doesn't have view");
+                    KDDW_CDEBUG(Focus, "FocusScope::focus: Dw doesn't have view");
                 }
             } else {
-                KDDW_DEBUG("FocusScope::focus: Group doesn't have current DW");
+                KDDW_CDEBUG(Focus, "FocusScope::focus: Group doesn't have current DW");
             }
         } else {
             // Not a use case right now
-            KDDW_DEBUG("FocusScope::focus: No group found");
+            KDDW_CDEBUG(Focus, "FocusScope::focus: No group found");
             d->m_thisView->setFocus(reason);
         }
     }
@@ -138,35 +151,121 @@ void FocusScope::Private::setIsFocused(bool is)
 
 void FocusScope::Private::onFocusedViewChanged(std::shared_ptr<View> view)
 {
-    if (!view || view->isNull()) {
-        setIsFocused(false);
-        return;
-    }
+    m_numFocusNotifications++;
 
-    const bool is = isInFocusScope(view);
     const bool focusViewChanged = !m_lastFocusedInScope || m_lastFocusedInScope->isNull()
         || !m_lastFocusedInScope->equals(view);
-    if (is && focusViewChanged && !view->is(ViewType::TitleBar)) {
+    if (focusViewChanged && !view->is(ViewType::TitleBar)) {
         m_lastFocusedInScope = view;
-        setIsFocused(is);
+        setIsFocused(true);
         /* Q_EMIT */ q->focusedWidgetChangedCallback();
     } else {
-        setIsFocused(is);
+        setIsFocused(true);
     }
 }
 
-bool FocusScope::Private::isInFocusScope(std::shared_ptr<View> view) const
+void FocusScope::Private::onFocusLost()
 {
-    if (m_thisView.isNull())
-        return false;
+    m_numFocusNotifications++;
+    setIsFocused(false);
+}
+
+void FocusRouter::addScope(FocusScope *scope, HANDLE handle)
+{
+    m_scopesByHandle[handle] = scope;
+
+    // The scope might be created around an already focused view
+    auto view = Platform::instance()->focusedView();
+    if (!view || view->isNull())
+        return;
+
+    const Resolution resolution = resolve(view);
+    for (const auto &it : resolution.scopes) {
+        if (it.second == scope) {
+            m_focusedScopes.push_back(it);
+            scope->d->onFocusedViewChanged(view);
+            return;
+        }
+    }
+}
+
+void FocusRouter::removeScope(FocusScope *scope, HANDLE handle)
+{
+    auto it = m_scopesByHandle.find(handle);
+    if (it != m_scopesByHandle.end() && it->second == scope)
+        m_scopesByHandle.erase(it);
+
+    m_focusedScopes.erase(std::remove(m_focusedScopes.begin(), m_focusedScopes.end(), std::make_pair(handle, scope)),
+                          m_focusedScopes.end());
+}
+
+void FocusRouter::setDockRegistry(DockRegistry *registry)
+{
+    m_dockRegistry = registry;
+}
+
+bool FocusRouter::isRegistered(HANDLE handle, FocusScope *scope) const
+{
+    auto it = m_scopesByHandle.find(handle);
+    return it != m_scopesByHandle.end() && it->second == scope;
+}
+
+FocusRouter::Resolution FocusRouter::resolve(std::shared_ptr<View> view) const
+{
+    Resolution resolution;
+    bool dockWidgetResolved = false;
 
     auto p = (view && !view->isNull()) ? view : std::shared_ptr<View>();
     while (p) {
-        if (p->handle() == m_thisView->handle())
-            return true;
+        if (!m_scopesByHandle.empty()) {
+            auto it = m_scopesByHandle.find(p->handle());
+            if (it != m_scopesByHandle.end() && !it->second->d->m_thisView.isNull())
+                resolution.scopes.push_back(*it);
+        }
+
+        if (!dockWidgetResolved) {
+            if (auto group = p->asGroupController()) {
+                // Special case: The focused widget is inside the group but not inside the dockwidget.
+                // For example, it's a line edit in the QTabBar. We still need to send the signal for
+                // the current dw in the tab group
+                resolution.dockWidget = group->currentDockWidget();
+                resolution.hasDockWidget = resolution.dockWidget != nullptr;
+                dockWidgetResolved = true;
+            } else if (auto dw = p->asDockWidgetController()) {
+                resolution.dockWidget = dw;
+                dockWidgetResolved = true;
+            }
+        }
 
         p = p->parentView();
     }
 
-    return false;
+    return resolution;
+}
+
+void FocusRouter::onFocusedViewChanged(std::shared_ptr<View> view)
+{
+    if (view && view->isNull())
+        view = {};
+
+    Resolution resolution = resolve(view);
+
+    if (m_dockRegistry && resolution.hasDockWidget)
+        m_dockRegistry->setFocusedDockWidget(resolution.dockWidget);
+
+    // Callbacks might delete scopes or change focus again, so work on copies and check
+    // that each scope is still alive before notifying it
+    const ScopeList previouslyFocused = m_focusedScopes;
+    m_focusedScopes = resolution.scopes;
+
+    for (const auto &it : previouslyFocused) {
+        if (std::find(resolution.scopes.cbegin(), resolution.scopes.cend(), it) == resolution.scopes.cend()
+            && isRegistered(it.first, it.second))
+            it.second->d->onFocusLost();
+    }
+
+    for (const auto &it : std::as_const(resolution.scopes)) {
+        if (isRegistered(it.first, it.second))
+            it.second->d->onFocusedViewChanged(view);
+    }
 }
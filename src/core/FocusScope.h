@@ -45,12 +45,18 @@ public:
     /// This will call QWidget::focus() on the last QWidget that was focused in this scope.
     void focus(Qt::FocusReason = Qt::OtherFocusReason);
 
+#ifdef DOCKS_DEVELOPER_MODE
+    /// @brief Returns how many times this scope was told that it gained or lost focus. For tests.
+    int numFocusNotifications() const;
+#endif
+
 protected:
     ///@brief reimplement in the 1st QObject derived class
     virtual void isFocusedChangedCallback() = 0;
     virtual void focusedWidgetChangedCallback() = 0;
 
 private:
+    friend class FocusRouter;
     class Private;
     Private *const d;
 };
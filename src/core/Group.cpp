@@ -331,7 +331,7 @@ FloatingWindow *Group::detachTab(DockWidget *dockWidget)
     // We're potentially already dead at this point, as groups with 0 tabs auto-destruct. Don't
     // access members from this point.
 
-    auto floatingWindow = new FloatingWindow(newGroup, {});
+    auto floatingWindow = FloatingWindow::create(newGroup);
     r.moveTopLeft(globalPoint);
     floatingWindow->setSuggestedGeometry(r, SuggestedGeometryHint_GeometryIsFromDocked);
     floatingWindow->view()->show();
@@ -407,7 +407,13 @@ int Group::dockWidgetCount() const
 
 void Group::onDockWidgetCountChanged()
 {
-    if (isEmpty() && !isCentralGroup()) {
+    if (isEmpty() && isOverlayed()) {
+        // Overlay groups are reused by their MainWindow, see MainWindow::overlayOnSideBar()
+        // Until then it's parked: hidden and out of DockRegistry::groups(), so layout queries and
+        // LayoutSaver don't see it as a live group.
+        view()->setVisible(false);
+        DockRegistry::self()->unregisterGroup(this);
+    } else if (isEmpty() && !isCentralGroup()) {
         scheduleDeleteLater();
     } else {
         updateTitleBarVisibility();
@@ -583,14 +589,14 @@ void Group::restoreToPreviousPosition()
     }
 
     if (!d->m_layoutItem) {
-        KDDW_DEBUG("Group::restoreToPreviousPosition: There's no previous position known");
+        KDDW_CDEBUG(Restore, "Group::restoreToPreviousPosition: There's no previous position known");
         return;
     }
 
     if (!d->m_layoutItem->isPlaceholder()) {
         // Maybe in this case just fold the group into the placeholder, which probably has other
         // dockwidgets which were added meanwhile. TODO
-        KDDW_DEBUG("Group::restoreToPreviousPosition: Previous position isn't a placeholder");
+        KDDW_CDEBUG(Restore, "Group::restoreToPreviousPosition: Previous position isn't a placeholder");
         return;
     }
 
@@ -678,13 +684,20 @@ bool Group::hasTabsVisible() const
 }
 
 Vector<QString> Group::affinities() const
+{
+    return affinitySet().names;
+}
+
+const AffinitySet &Group::affinitySet() const
 {
     if (isEmpty()) {
         if (auto m = mainWindow())
-            return m->affinities();
-        return {};
+            return m->affinitySet();
+
+        static const AffinitySet s_noAffinities;
+        return s_noAffinities;
     } else {
-        return dockWidgetAt(0)->affinities();
+        return dockWidgetAt(0)->affinitySet();
     }
 }
 
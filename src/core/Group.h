@@ -219,6 +219,10 @@ public:
 
     Vector<QString> affinities() const;
 
+    /// @internal
+    /// @brief Returns the affinities, interned for matching
+    const AffinitySet &affinitySet() const;
+
     ///@brief sets the layout item that either contains this Group in the layout or is a placeholder
     void setLayoutItem(Core::Item *item);
 
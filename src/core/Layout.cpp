@@ -25,13 +25,49 @@
 #include "Group.h"
 #include "FloatingWindow.h"
 #include "MainWindow.h"
+#include "DelayedCall_p.h"
 #include "layouting/Item_p.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 using namespace KDDockWidgets;
 using namespace KDDockWidgets::Core;
 
+namespace {
+
+/// @brief Applies the next frame of a layout's geometry transitions
+class DelayedTransitionFrame : public DelayedCall
+{
+public:
+    explicit DelayedTransitionFrame(Layout *layout)
+        : m_layout(layout)
+    {
+    }
+
+    void call() override
+    {
+        if (m_layout)
+            m_layout->d_ptr()->advanceTransitions();
+    }
+
+private:
+    ObjectGuard<Layout> m_layout;
+};
+
+}
+
+
+/// Like Group::fromItem() but ignores groups which are being destroyed
+static Core::Group *liveGroupFromItem(const Core::Item *item)
+{
+    if (auto guest = item->guest()) {
+        if (!guest->freed())
+            return Group::fromItem(item);
+    }
+
+    return nullptr;
+}
 
 Layout::Layout(ViewType type, View *view)
     : Controller(type, view)
@@ -61,6 +97,9 @@ void Layout::viewAboutToBeDeleted()
             d->m_rootItem = nullptr;
         }
 
+        // Pooled separators have views parented to ours, delete them while it's still alive
+        d->clearSeparatorPool();
+
         d->m_viewDeleted = true;
     }
 }
@@ -102,6 +141,7 @@ void Layout::setRootItem(Core::ItemContainer *root)
 {
     delete d->m_rootItem;
     d->m_rootItem = root;
+    d->m_counts.valid = false;
     d->m_rootItem->numVisibleItemsChanged.connect(
         [this](int count) { d->visibleWidgetCountChanged.emit(count); });
 
@@ -148,6 +188,16 @@ void Layout::dumpLayout() const
     d->m_rootItem->dumpLayout();
 }
 
+LayoutStatistics Layout::statistics() const
+{
+    return d->layoutStatistics();
+}
+
+void Layout::resetStatistics()
+{
+    d->resetLayoutStatistics();
+}
+
 void Layout::restorePlaceholder(Core::DockWidget *dw, Core::Item *item, int tabIndex)
 {
     if (item->isPlaceholder()) {
@@ -208,12 +258,12 @@ bool Layout::containsGroup(const Core::Group *group) const
 
 int Layout::count() const
 {
-    return d->m_rootItem->count_recursive();
+    return d->counts().items;
 }
 
 int Layout::visibleCount() const
 {
-    return d->m_rootItem->visibleCount_recursive();
+    return d->counts().visibleItems;
 }
 
 int Layout::placeholderCount() const
@@ -232,13 +282,58 @@ Core::Item *Layout::itemForGroup(const Core::Group *group) const
 Core::DockWidget::List Layout::dockWidgets() const
 {
     Core::DockWidget::List dockWidgets;
-    const Core::Group::List groups = this->groups();
-    for (Core::Group *group : groups)
-        dockWidgets.append(group->dockWidgets());
+    dockWidgets.reserve(groupCount());
+    visitDockWidgets([&dockWidgets](Core::DockWidget *dw) {
+        dockWidgets.push_back(dw);
+        return true;
+    });
 
     return dockWidgets;
 }
 
+int Layout::groupCount() const
+{
+    return d->counts().groups;
+}
+
+int Layout::visibleGroupCount() const
+{
+    return d->counts().visibleGroups;
+}
+
+int Layout::dockWidgetCount() const
+{
+    // Not cached, as adding tabs doesn't touch the item tree. Still cheap, as it doesn't allocate.
+    int count = 0;
+    visitGroups([&count](Core::Group *group) {
+        count += group->dockWidgetCount();
+        return true;
+    });
+
+    return count;
+}
+
+void Layout::visitGroups(const std::function<bool(Core::Group *)> &visitor) const
+{
+    d->m_rootItem->visitItems_recursive([&visitor](Core::Item *item) {
+        if (auto group = liveGroupFromItem(item))
+            return visitor(group);
+        return true;
+    });
+}
+
+void Layout::visitDockWidgets(const std::function<bool(Core::DockWidget *)> &visitor) const
+{
+    visitGroups([&visitor](Core::Group *group) {
+        const int count = group->dockWidgetCount();
+        for (int i = 0; i < count; ++i) {
+            if (!visitor(group->dockWidgetAt(i)))
+                return false;
+        }
+        return true;
+    });
+}
+
 Core::Group::List Layout::groupsFrom(View *groupOrMultiSplitter) const
 {
     if (auto group = groupOrMultiSplitter->asGroupController())
@@ -252,16 +347,13 @@ Core::Group::List Layout::groupsFrom(View *groupOrMultiSplitter) const
 
 Core::Group::List Layout::groups() const
 {
-    const Core::Item::List items = d->m_rootItem->items_recursive();
-
     Core::Group::List result;
-    result.reserve(items.size());
+    result.reserve(groupCount());
 
-    for (Core::Item *item : items) {
-        if (auto group = Group::fromItem(item)) {
-            result.push_back(group);
-        }
-    }
+    visitGroups([&result](Core::Group *group) {
+        result.push_back(group);
+        return true;
+    });
 
     return result;
 }
@@ -374,6 +466,33 @@ Layout::Private *Layout::d_ptr()
     return d;
 }
 
+const Layout::Private::Counts &Layout::Private::counts() const
+{
+    const uint32_t version = m_rootItem->structureVersion();
+    if (m_counts.valid && m_counts.structureVersion == version)
+        return m_counts;
+
+    Counts counts;
+    counts.structureVersion = version;
+    counts.valid = true;
+    m_rootItem->visitItems_recursive([&counts](Core::Item *item) {
+        const bool visible = item->isVisible();
+        counts.items++;
+        if (visible)
+            counts.visibleItems++;
+
+        if (liveGroupFromItem(item)) {
+            counts.groups++;
+            if (visible)
+                counts.visibleGroups++;
+        }
+        return true;
+    });
+
+    m_counts = counts;
+    return m_counts;
+}
+
 bool Layout::Private::supportsHonouringLayoutMinSize() const
 {
     if (auto window = q->view()->window()) {
@@ -384,6 +503,33 @@ bool Layout::Private::supportsHonouringLayoutMinSize() const
     }
 }
 
+int Layout::Private::maxPooledSeparators() const
+{
+    return Config::self().separatorPoolSize();
+}
+
+int Layout::Private::transitionDuration() const
+{
+    return Config::self().layoutTransitionDuration();
+}
+
+int Layout::Private::transitionFrameInterval() const
+{
+    // One frame per display refresh
+    const double refreshRate = Platform::instance()->screenRefreshRateFor(q->view());
+    return refreshRate > 0 ? std::max(1, int(1000.0 / refreshRate)) : LayoutingHost::transitionFrameInterval();
+}
+
+void Layout::Private::scheduleTransitionFrame(int ms)
+{
+    Platform::instance()->runDelayed(ms, new DelayedTransitionFrame(q));
+}
+
+bool Layout::Private::profilingEnabled() const
+{
+    return Config::self().layoutProfilingEnabled();
+}
+
 Layout::Private::Private(Layout *qq)
     : q(qq)
 {
@@ -30,6 +30,8 @@
 #include "kddockwidgets/LayoutSaver.h"
 #include "kddockwidgets/QtCompat_p.h"
 
+#include <functional>
+
 namespace KDDockWidgets {
 
 namespace Core {
@@ -112,6 +114,13 @@ public:
     /// @brief dumps the layout to stderr
     void dumpLayout() const;
 
+    /// @brief Returns how much time and work each kind of operation cost this layout so far
+    /// Only recorded while Config::layoutProfilingEnabled() is true.
+    LayoutStatistics statistics() const;
+
+    /// @brief Clears the recorded statistics
+    void resetStatistics();
+
     /**
      * @brief setter for the contents size
      * The "contents size" is just the size() of this layout. However, since resizing
@@ -173,6 +182,26 @@ public:
     /// @brief Returns the list of dock widgets contained in this layout
     Vector<Core::DockWidget *> dockWidgets() const;
 
+    /// @brief Returns the number of groups in this layout, including placeholders' groups, if any
+    /// The count is cached and only recomputed after the layout's items change.
+    int groupCount() const;
+
+    /// @brief Returns the number of visible groups in this layout
+    int visibleGroupCount() const;
+
+    /// @brief Returns the number of dock widgets in this layout
+    /// Same as dockWidgets().size() but without building the list.
+    int dockWidgetCount() const;
+
+    /// @brief Calls @p visitor for each group in this layout, without building a list
+    /// Iteration stops as soon as @p visitor returns false.
+    /// @p visitor must not add or remove groups. Use groups() for that.
+    void visitGroups(const std::function<bool(Core::Group *)> &visitor) const;
+
+    /// @brief Calls @p visitor for each dock widget in this layout, without building a list
+    /// Same semantics as visitGroups()
+    void visitDockWidgets(const std::function<bool(Core::DockWidget *)> &visitor) const;
+
     /**
      * @brief Removes an item from this MultiSplitter.
      */
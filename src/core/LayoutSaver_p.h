@@ -336,11 +336,15 @@ public:
     void deserializeWindowGeometry(const T &saved, Core::Window::Ptr);
     void deleteEmptyGroups() const;
     void clearRestoredProperty();
+    std::string createSnapshot() const;
 
     DockRegistry *const m_dockRegistry;
     InternalRestoreOptions m_restoreOptions = {};
     Vector<QString> m_affinityNames;
 
+    /// Filled by LayoutSaver::updateSnapshot()
+    std::string m_snapshot;
+
     /// If a layout is restored but the dock widget doesn't exist, we store its last position here
     /// so when we create the dock widget we can finally restore
     static std::unordered_map<QString, std::shared_ptr<KDDockWidgets::Position>> s_unrestoredPositions;
@@ -23,6 +23,11 @@ public:
     explicit Private(Layout *);
     ~Private() override;
     bool supportsHonouringLayoutMinSize() const override;
+    int maxPooledSeparators() const override;
+    int transitionDuration() const override;
+    int transitionFrameInterval() const override;
+    void scheduleTransitionFrame(int ms) override;
+    bool profilingEnabled() const override;
 
     Layout *const q;
     bool m_inResizeEvent = false;
@@ -32,6 +37,21 @@ public:
     KDBindings::Signal<int> visibleWidgetCountChanged;
 
     bool m_viewDeleted = false;
+
+    /// @brief Counts derived from the item tree
+    /// Recomputed lazily, in a single pass, whenever the root item's structureVersion() changes.
+    struct Counts
+    {
+        uint32_t structureVersion = 0;
+        bool valid = false;
+        int items = 0;
+        int visibleItems = 0;
+        int groups = 0;
+        int visibleGroups = 0;
+    };
+
+    const Counts &counts() const;
+    mutable Counts m_counts;
 };
 
 }
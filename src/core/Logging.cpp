@@ -10,3 +10,59 @@
 */
 
 #include "Logging_p.h"
+
+#include <atomic>
+
+#if defined(KDDW_HAS_SPDLOG) && defined(KDDW_ASYNC_LOGGING)
+#include <spdlog/async.h>
+#endif
+
+using namespace KDDockWidgets;
+
+#ifdef KDDW_HAS_SPDLOG
+
+namespace {
+
+/// Everything is let through by default, the logger's level decides
+std::atomic<int> s_categoryLevels[int(LogCategory::Count)] = {};
+
+std::shared_ptr<spdlog::logger> createLogger()
+{
+    // The application might have registered its own logger
+    if (auto logger = spdlog::get(spdlogLoggerName()))
+        return logger;
+
+#ifdef KDDW_ASYNC_LOGGING
+    // Formatting and writing happen in spdlog's thread pool, not in the GUI thread
+    return spdlog::create_async<spdlog::sinks::stdout_color_sink_mt>(spdlogLoggerName());
+#else
+    return spdlog::stdout_color_mt(spdlogLoggerName());
+#endif
+}
+
+}
+
+spdlog::logger *Logging::logger()
+{
+    static const std::shared_ptr<spdlog::logger> s_logger = createLogger();
+    return s_logger.get();
+}
+
+bool Logging::categoryShouldLog(LogCategory category, spdlog::level::level_enum level)
+{
+    return int(level) >= s_categoryLevels[int(category)].load(std::memory_order_relaxed);
+}
+
+void KDDockWidgets::setLogLevel(LogCategory category, int level)
+{
+    if (category >= LogCategory::General && category < LogCategory::Count)
+        s_categoryLevels[int(category)].store(level, std::memory_order_relaxed);
+}
+
+#else
+
+void KDDockWidgets::setLogLevel(LogCategory, int)
+{
+}
+
+#endif
@@ -28,22 +28,51 @@
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
-#define KDDW_LOG(level, ...)                                                     \
-    if (spdlog::should_log(level)) {                                             \
-        auto logger = spdlog::get(KDDockWidgets::spdlogLoggerName());            \
-        if (!logger) {                                                           \
-            logger = spdlog::stdout_color_mt(KDDockWidgets::spdlogLoggerName()); \
-        }                                                                        \
-        if (logger->should_log(level)) {                                         \
-            logger->log(level, __VA_ARGS__);                                     \
-        }                                                                        \
+namespace KDDockWidgets::Logging {
+
+/// @brief Returns KDDW's logger, named spdlogLoggerName()
+/// If the application didn't register one by then, it's created on first use.
+/// The pointer is cached, so logging doesn't look the logger up in spdlog's registry, which locks a mutex.
+DOCKS_EXPORT spdlog::logger *logger();
+
+/// @brief Returns whether @p category lets @p level through. See KDDockWidgets::setLogLevel()
+DOCKS_EXPORT bool categoryShouldLog(LogCategory category, spdlog::level::level_enum level);
+
+}
+
+#define KDDW_CLOG(category, level, ...)                                                        \
+    if (spdlog::should_log(level) && KDDockWidgets::Logging::categoryShouldLog(category, level)) { \
+        auto logger = KDDockWidgets::Logging::logger();                                        \
+        if (logger->should_log(level)) {                                                       \
+            logger->log(level, __VA_ARGS__);                                                   \
+        }                                                                                      \
     }
 
+#define KDDW_LOG(level, ...) KDDW_CLOG(KDDockWidgets::LogCategory::General, level, __VA_ARGS__)
+
 #define KDDW_ERROR(...) KDDW_LOG(spdlog::level::err, __VA_ARGS__)
 #define KDDW_WARN(...) KDDW_LOG(spdlog::level::warn, __VA_ARGS__)
 #define KDDW_INFO(...) KDDW_LOG(spdlog::level::info, __VA_ARGS__)
+
+/// Variants for a specific LogCategory, for example: KDDW_CDEBUG(Drag, "Drag started")
+#define KDDW_CINFO(category, ...) KDDW_CLOG(KDDockWidgets::LogCategory::category, spdlog::level::info, __VA_ARGS__)
+
+// Built with -DKDDockWidgets_NO_DEBUG_LOGS=ON, debug and trace statements are compiled out
+#ifdef KDDW_NO_DEBUG_LOGS
+
+#define KDDW_DEBUG(...) (( void )0)
+#define KDDW_TRACE(...) (( void )0)
+#define KDDW_CDEBUG(category, ...) (( void )0)
+#define KDDW_CTRACE(category, ...) (( void )0)
+
+#else
+
 #define KDDW_DEBUG(...) KDDW_LOG(spdlog::level::debug, __VA_ARGS__)
 #define KDDW_TRACE(...) KDDW_LOG(spdlog::level::trace, __VA_ARGS__)
+#define KDDW_CDEBUG(category, ...) KDDW_CLOG(KDDockWidgets::LogCategory::category, spdlog::level::debug, __VA_ARGS__)
+#define KDDW_CTRACE(category, ...) KDDW_CLOG(KDDockWidgets::LogCategory::category, spdlog::level::trace, __VA_ARGS__)
+
+#endif
 
 #else
 
@@ -51,6 +80,9 @@
 #define KDDW_INFO(...) (( void )0)
 #define KDDW_DEBUG(...) (( void )0)
 #define KDDW_TRACE(...) (( void )0)
+#define KDDW_CINFO(category, ...) (( void )0)
+#define KDDW_CDEBUG(category, ...) (( void )0)
+#define KDDW_CTRACE(category, ...) (( void )0)
 
 #ifdef KDDW_FRONTEND_QT
 
@@ -121,3 +121,33 @@ void MDILayout::resizeDockWidget(Core::Group *group, Size size)
 
     item->setSize(size.expandedTo(group->view()->minSize()));
 }
+
+void MDILayout::arrange(MDIArrangement arrangement)
+{
+    m_rootItem->arrange(arrangement);
+}
+
+Point MDILayout::suggestedPosition(Size size) const
+{
+    return m_rootItem->suggestedPosition(size);
+}
+
+void MDILayout::raiseDockWidget(Core::DockWidget *dw)
+{
+    raiseDockWidget(dw->d->group());
+}
+
+void MDILayout::raiseDockWidget(Core::Group *group)
+{
+    if (!group)
+        return;
+
+    Core::Item *item = itemForGroup(group);
+    if (!item) {
+        KDDW_ERROR("Group not found in the layout {}", ( void * )group);
+        return;
+    }
+
+    m_rootItem->raise(item);
+    group->view()->raise();
+}
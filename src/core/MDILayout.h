@@ -57,6 +57,21 @@ public:
     /// @brief sets the size and position of the dock widget @p group
     void setDockWidgetGeometry(Core::Group *group, Rect);
 
+    /// @brief Positions and resizes all visible MDI windows according to @p arrangement
+    /// Geometries are computed in one pass and applied as a single batched update.
+    void arrange(MDIArrangement arrangement);
+
+    /// @brief Returns where a window of size @p size would overlap the existing ones the least
+    /// Pass it to addDockWidget() to place new windows automatically.
+    Point suggestedPosition(Size size) const;
+
+    /// @brief Puts dock widget @p dw on top of the other MDI windows
+    void raiseDockWidget(Core::DockWidget *dw);
+
+    /// @brief Puts @p group on top of the other MDI windows
+    /// Convenience overload.
+    void raiseDockWidget(Core::Group *group);
+
 private:
     Core::ItemFreeContainer *const m_rootItem;
 };
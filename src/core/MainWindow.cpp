@@ -73,10 +73,21 @@ void MainWindow::init(const QString &name)
     d->m_resizeConnection = view()->d->resized.connect([this](Size size) {
         d->onResized(size);
     });
+
+    // The central area and the sidebars can move without the main window being resized
+    d->m_overlayRectsConnections.push_back(d->m_layout->view()->d->resized.connect([this] { d->invalidateOverlayRects(); }));
+    for (const auto &it : d->m_sideBars)
+        d->m_overlayRectsConnections.push_back(it.second->view()->d->resized.connect([this] { d->invalidateOverlayRects(); }));
 }
 
 MainWindow::~MainWindow()
 {
+    // Parked overlay groups aren't registered, so they can't keep DockRegistry alive
+    for (auto &it : d->m_overlayGroups) {
+        if (it.second && it.second->isEmpty())
+            delete it.second.data();
+    }
+
     DockRegistry::self()->unregisterMainWindow(this);
     delete d;
 }
@@ -86,7 +97,7 @@ void MainWindow::addDockWidgetAsTab(Core::DockWidget *widget)
     assert(widget);
     KDDW_DEBUG("dock={}", ( void * )widget);
 
-    if (!DockRegistry::self()->affinitiesMatch(d->affinities, widget->affinities())) {
+    if (!DockRegistry::self()->affinitiesMatch(d->affinities, widget->affinitySet())) {
         KDDW_ERROR("Refusing to dock widget with incompatible affinity. {} {}", widget->affinities(), affinities());
         return;
     }
@@ -219,19 +230,24 @@ void MainWindow::setAffinities(const Vector<QString> &affinityNames)
     Vector<QString> affinities = affinityNames;
     affinities.removeAll(QString());
 
-    if (d->affinities == affinities)
+    if (d->affinities.names == affinities)
         return;
 
-    if (!d->affinities.isEmpty()) {
+    if (!d->affinities.names.isEmpty()) {
         KDDW_ERROR("Affinity is already set, refusing to change."
                    "Submit a feature request with a good justification.");
         return;
     }
 
-    d->affinities = affinities;
+    d->affinities = DockRegistry::self()->internAffinities(affinities);
 }
 
 Vector<QString> MainWindow::affinities() const
+{
+    return d->affinities.names;
+}
+
+const AffinitySet &MainWindow::affinitySet() const
 {
     return d->affinities;
 }
@@ -269,6 +285,52 @@ CursorPositions MainWindow::Private::allowedResizeSides(SideBarLocation loc) con
 }
 
 Rect MainWindow::Private::rectForOverlay(Core::Group *group, SideBarLocation location) const
+{
+    const int mask = visibleSideBarsMask();
+    if (mask != m_overlayRectsSideBarsMask) {
+        // The overlay spans between the visible sidebars
+        m_overlayRects.clear();
+        m_overlayRectsSideBarsMask = mask;
+    }
+
+    auto it = m_overlayRects.find(location);
+    if (it == m_overlayRects.end())
+        it = m_overlayRects.emplace(location, computeOverlayRect(location)).first;
+
+    Rect rect = it->second;
+    if (rect.isNull())
+        return rect;
+
+    // The edge touching the sidebar stays put, the group grows away from it
+    const Size groupMinSize = group->view()->minSize();
+    switch (location) {
+    case SideBarLocation::North:
+        rect.setHeight(std::max(rect.height(), groupMinSize.height()));
+        break;
+    case SideBarLocation::South: {
+        const int bottom = rect.bottom();
+        rect.setHeight(std::max(rect.height(), groupMinSize.height()));
+        rect.moveBottom(bottom);
+        break;
+    }
+    case SideBarLocation::West:
+        rect.setWidth(std::max(rect.width(), groupMinSize.width()));
+        break;
+    case SideBarLocation::East: {
+        const int right = rect.right();
+        rect.setWidth(std::max(rect.width(), groupMinSize.width()));
+        rect.moveRight(right);
+        break;
+    }
+    case SideBarLocation::None:
+    case SideBarLocation::Last:
+        break;
+    }
+
+    return rect;
+}
+
+Rect MainWindow::Private::computeOverlayRect(SideBarLocation location) const
 {
     Core::SideBar *sb = q->sideBar(location);
     if (!sb)
@@ -289,7 +351,7 @@ Rect MainWindow::Private::rectForOverlay(Core::Group *group, SideBarLocation loc
             (leftSideBar && leftSideBar->isVisible()) ? leftSideBar->width() : 0;
         const int rightSideBarWidth =
             (rightSideBar && rightSideBar->isVisible()) ? rightSideBar->width() : 0;
-        rect.setHeight(std::max(300, group->view()->minSize().height()));
+        rect.setHeight(300);
         rect.setWidth(centralAreaGeo.width() - margin * 2 - leftSideBarWidth - rightSideBarWidth);
         rect.moveLeft(margin + leftSideBarWidth);
         if (location == SideBarLocation::South) {
@@ -308,7 +370,7 @@ Rect MainWindow::Private::rectForOverlay(Core::Group *group, SideBarLocation loc
             (topSideBar && topSideBar->isVisible()) ? topSideBar->height() : 0;
         const int bottomSideBarHeight =
             (bottomSideBar && bottomSideBar->isVisible()) ? bottomSideBar->height() : 0;
-        rect.setWidth(std::max(300, group->view()->minSize().width()));
+        rect.setWidth(300);
         rect.setHeight(centralAreaGeo.height() - topSideBarHeight - bottomSideBarHeight
                        - centerWidgetMargins.top() - centerWidgetMargins.bottom());
         rect.moveTop(sb->view()->mapTo(q->view(), Point(0, 0)).y() + topSideBarHeight - 1);
@@ -329,6 +391,37 @@ Rect MainWindow::Private::rectForOverlay(Core::Group *group, SideBarLocation loc
     return rect;
 }
 
+void MainWindow::Private::invalidateOverlayRects()
+{
+    m_overlayRects.clear();
+}
+
+int MainWindow::Private::visibleSideBarsMask() const
+{
+    int mask = 0;
+    for (const auto &it : m_sideBars) {
+        if (it.second->isVisible())
+            mask |= 1 << int(it.first);
+    }
+
+    return mask;
+}
+
+Core::Group *MainWindow::Private::overlayGroup(SideBarLocation location)
+{
+    ObjectGuard<Core::Group> &group = m_overlayGroups[location];
+    if (!group || group->beingDeletedLater()) {
+        group = new Core::Group(nullptr, FrameOption_IsOverlayed);
+        group->setParentView(q->view());
+        group->setAllowedResizeSides(allowedResizeSides(location));
+    } else if (group->isEmpty()) {
+        // It was parked since the last overlay, see Group::onDockWidgetCountChanged()
+        DockRegistry::self()->registerGroup(group);
+    }
+
+    return group;
+}
+
 static SideBarLocation opposedSideBarLocationForBorder(Core::LayoutBorderLocation loc)
 {
     switch (loc) {
@@ -579,14 +672,14 @@ void MainWindow::overlayOnSideBar(Core::DockWidget *dw)
     // We only support one overlay at a time, remove any existing overlay
     clearSideBarOverlay();
 
-    auto group = new Core::Group(nullptr, FrameOption_IsOverlayed);
-    group->setParentView(view());
+    // Reuse the group, so toggling between auto-hidden dock widgets is just a reparent
+    Core::Group *group = d->overlayGroup(sb->location());
     d->m_overlayedDockWidget = dw;
     group->addTab(dw);
     d->updateOverlayGeometry(dw->d->lastPosition()->lastOverlayedGeometry(sb->location()).size());
 
-    group->setAllowedResizeSides(d->allowedResizeSides(sb->location()));
     group->view()->show();
+    group->view()->raise();
 
     dw->d->isOverlayedChanged.emit(true);
 }
@@ -617,7 +710,6 @@ void MainWindow::clearSideBarOverlay(bool deleteGroup)
     overlayedDockWidget->d->lastPosition()->setLastOverlayedGeometry(loc, group->geometry());
 
     CloseReasonSetter reason(CloseReason::OverlayCollapse);
-    group->unoverlay();
 
     if (deleteGroup) {
         // only update actions at the end
@@ -633,10 +725,18 @@ void MainWindow::clearSideBarOverlay(bool deleteGroup)
 
         overlayedDockWidget->d->isOverlayedChanged.emit(false);
         overlayedDockWidget = nullptr;
-        delete group;
+
+        // Kept for the next overlay, see overlayOnSideBar()
+        group->view()->setVisible(false);
     } else {
         // No cleanup, just unset. When we drag the overlay it becomes a normal floating window
-        // meaning we reuse Frame. Don't delete it.
+        // meaning we reuse Frame. Don't delete it, but don't reuse it as overlay either.
+        group->unoverlay();
+        for (auto &it : d->m_overlayGroups) {
+            if (it.second == group)
+                it.second.clear();
+        }
+
         overlayedDockWidget->d->isOverlayedChanged.emit(false);
         overlayedDockWidget = nullptr;
     }
@@ -737,10 +837,10 @@ bool MainWindow::deserialize(const LayoutSaver::MainWindow &mw)
         return false;
     }
 
-    if (d->affinities != mw.affinities) {
-        KDDW_ERROR("Affinity name changed from {} to {}", d->affinities, mw.affinities);
+    if (d->affinities.names != mw.affinities) {
+        KDDW_ERROR("Affinity name changed from {} to {}", d->affinities.names, mw.affinities);
 
-        d->affinities = mw.affinities;
+        d->affinities = DockRegistry::self()->internAffinities(mw.affinities);
     }
 
     // Restore the SideBars
@@ -788,7 +888,7 @@ LayoutSaver::MainWindow MainWindow::serialize() const
     m.screenIndex = Platform::instance()->screenNumberForView(view());
     m.screenSize = Platform::instance()->screenSizeFor(view());
     m.multiSplitterLayout = layout()->serialize();
-    m.affinities = d->affinities;
+    m.affinities = d->affinities.names;
     m.windowState = window ? window->windowState() : WindowState::None;
 
     for (SideBarLocation loc : { SideBarLocation::North, SideBarLocation::East,
@@ -861,5 +961,6 @@ void MainWindow::setOverlayMargin(int margin)
         return;
 
     d->m_overlayMargin = margin;
+    d->invalidateOverlayRects();
     d->overlayMarginChanged.emit(margin);
 }
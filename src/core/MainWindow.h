@@ -157,6 +157,10 @@ public:
      */
     Vector<QString> affinities() const;
 
+    /// @internal
+    /// @brief Returns the affinities, interned for matching
+    const AffinitySet &affinitySet() const;
+
     /// @brief layouts all the widgets so they have an equal size within their parent container
     ///
     /// Note that the layout is a tree of nested horizontal and vertical container layouts. The
@@ -22,6 +22,9 @@
 
 #include <kdbindings/signal.h>
 
+#include <unordered_map>
+#include <vector>
+
 namespace KDDockWidgets {
 
 namespace Core {
@@ -87,6 +90,7 @@ public:
 
     void onResized(Size)
     {
+        invalidateOverlayRects();
         if (m_overlayedDockWidget)
             updateOverlayGeometry(m_overlayedDockWidget->d->group()->geometry().size());
     }
@@ -103,13 +107,19 @@ public:
     CursorPositions allowedResizeSides(SideBarLocation loc) const;
 
     Rect rectForOverlay(Core::Group *, SideBarLocation) const;
+    Rect computeOverlayRect(SideBarLocation) const;
+    void invalidateOverlayRects();
+    int visibleSideBarsMask() const;
+
+    /// @brief Returns the overlay group for @p location, creating it the first time
+    Core::Group *overlayGroup(SideBarLocation);
     SideBarLocation preferredSideBar(Core::DockWidget *) const;
     void updateOverlayGeometry(Size suggestedSize);
     void clearSideBars();
     Rect windowGeometry() const;
 
     QString name;
-    Vector<QString> affinities;
+    AffinitySet affinities;
     const MainWindowOptions m_options;
     MainWindow *const q;
     ObjectGuard<Core::DockWidget> m_overlayedDockWidget;
@@ -120,6 +130,18 @@ public:
     KDBindings::ScopedConnection m_resizeConnection;
     const bool m_supportsAutoHide;
     int m_overlayMargin = 1;
+
+    /// Overlay groups are reused between dock widgets, instead of being recreated on each toggle.
+    /// A group leaves the cache once it's dragged out and becomes a regular floating window, or
+    /// when its dock widget is closed. While no dock widget is overlayed on its side, the group is
+    /// hidden, empty and not in DockRegistry::groups().
+    std::unordered_map<SideBarLocation, ObjectGuard<Core::Group>> m_overlayGroups;
+
+    /// The overlay geometry by location, before honouring the group's min size.
+    /// Only recomputed after a resize or when a sidebar is shown or hidden.
+    mutable std::unordered_map<SideBarLocation, Rect> m_overlayRects;
+    mutable int m_overlayRectsSideBarsMask = 0;
+    std::vector<KDBindings::ScopedConnection> m_overlayRectsConnections;
 };
 
 }
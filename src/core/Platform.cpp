@@ -74,6 +74,8 @@ Platform::~Platform()
 
 Platform::Private::Private()
 {
+    m_focusRouter.m_connection = focusedViewChanged.connect(&FocusRouter::onFocusedViewChanged, &m_focusRouter);
+
     /// Out layouting engine can be used without KDDW, so by default doesn't
     /// depend on Core::Separator. Here we tell the layouting that we want to use our
     /// KDDW separators.
@@ -171,6 +173,10 @@ std::vector<KDDockWidgets::FrontendType> Platform::frontendTypes()
     types.push_back(FrontendType::Flutter);
 #endif
 
+#ifdef KDDW_FRONTEND_HEADLESS
+    types.push_back(FrontendType::Headless);
+#endif
+
     return types;
 }
 
@@ -217,6 +223,9 @@ void Platform::tests_initPlatform(int &argc, char **argv, KDDockWidgets::Fronten
         KDDW_UNUSED(argv);
 #endif
         break;
+    case FrontendType::Headless:
+        // Not supported in developer-mode, see CMakeLists.txt
+        break;
     }
 
     if (!platform) {
@@ -302,6 +311,11 @@ bool Platform::supportsAeroSnap() const
     return false;
 }
 
+double Platform::screenRefreshRateFor(View *) const
+{
+    return 60.0;
+}
+
 bool EventFilterInterface::enabled() const
 {
     return m_enabled;
@@ -83,6 +83,11 @@ public:
     /// @brief Returns the size of the screen where this view is in
     virtual Size screenSizeFor(View *) const = 0;
 
+    /// @brief Returns the refresh rate, in Hz, of the screen where this view is in
+    /// Used to cap drag motion processing, see Config::setDragMotionCappedAtRefreshRate()
+    /// The default implementation returns 60.
+    virtual double screenRefreshRateFor(View *) const;
+
     /// @brief Create an empty view
     /// For Qt this would just returns a empty QWidget or QQuickItem
     /// other frontends can return something as basic.
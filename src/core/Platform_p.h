@@ -12,6 +12,8 @@
 #pragma once
 
 #include "core/Platform.h"
+#include "core/FocusRouter_p.h"
+#include "core/DeletionService_p.h"
 #include "kdbindings/signal.h"
 
 #include <memory>
@@ -43,6 +45,12 @@ public:
     bool m_inDestruction = false;
 
     std::vector<EventFilterInterface *> m_globalEventFilters;
+
+    /// @brief Dispatches focusedViewChanged to the FocusScopes and DockRegistry
+    FocusRouter m_focusRouter;
+
+    /// @brief Deletes the controllers scheduled with Controller::destroyLater()
+    DeletionService m_deletionService;
 };
 
 }
@@ -67,15 +67,25 @@ struct Separator::Private : public LayoutingSeparator
 
     void free() override
     {
-#ifdef KDDW_FRONTEND_QT
         if (Config::self().internalFlags() & Config::InternalFlag_DeleteSeparatorsLater) {
-            q->deleteLater();
+            q->destroyLater();
             return;
         }
-#endif
+
         delete q;
     }
 
+    void setPooled(bool pooled) override
+    {
+        if (pooled) {
+            if (lazyResizeRubberBand)
+                lazyResizeRubberBand->hide();
+            q->setVisible(false);
+            // So the next setGeometry() isn't skipped
+            m_geometry = {};
+        }
+    }
+
     void raise() override
     {
         q->view()->raise();
@@ -170,7 +180,7 @@ void Separator::onMousePress()
 {
     d->onMousePress();
 
-    KDDW_DEBUG("Drag started");
+    KDDW_CDEBUG(Layouting, "Drag started");
 
     if (d->lazyResizeRubberBand) {
         setLazyPosition(position());
@@ -206,7 +216,7 @@ void Separator::onMouseMove(Point pos)
         // Workaround a bug in Qt where we're getting mouse moves without without the button being
         // pressed
         if (!Platform::instance()->isLeftMouseButtonPressed()) {
-            KDDW_DEBUG(
+            KDDW_CDEBUG(Layouting,
                 "Separator::onMouseMove: Ignoring spurious mouse event. Someone ate our ReleaseEvent");
             onMouseReleased();
             return;
@@ -217,7 +227,7 @@ void Separator::onMouseMove(Point pos)
         const bool mouseButtonIsReallyDown =
             (GetKeyState(VK_LBUTTON) & 0x8000) || (GetKeyState(VK_RBUTTON) & 0x8000);
         if (!mouseButtonIsReallyDown) {
-            KDDW_DEBUG(
+            KDDW_CDEBUG(Layouting,
                 "Separator::onMouseMove: Ignoring spurious mouse event. Someone ate our ReleaseEvent");
             onMouseReleased();
             return;
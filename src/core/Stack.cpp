@@ -127,7 +127,7 @@ std::unique_ptr<WindowBeingDragged> Stack::makeWindow()
 
     const Point globalPoint = view()->mapToGlobal(Point(0, 0));
 
-    auto floatingWindow = new FloatingWindow(d->m_group, {});
+    auto floatingWindow = FloatingWindow::create(d->m_group);
     r.moveTopLeft(globalPoint);
     floatingWindow->setSuggestedGeometry(r, SuggestedGeometryHint_GeometryIsFromDocked);
     floatingWindow->view()->show();
@@ -610,7 +610,7 @@ std::unique_ptr<WindowBeingDragged> TitleBar::makeWindow()
     Rect r = m_group->view()->geometry();
     r.moveTopLeft(m_group->mapToGlobal(Point(0, 0)));
 
-    auto floatingWindow = new Core::FloatingWindow(m_group, {});
+    auto floatingWindow = Core::FloatingWindow::create(m_group);
     floatingWindow->setSuggestedGeometry(r, SuggestedGeometryHint_GeometryIsFromDocked);
     floatingWindow->view()->show();
 
@@ -626,14 +626,8 @@ bool TitleBar::isWindow() const
 
 Core::DockWidget::List TitleBar::dockWidgets() const
 {
-    if (m_floatingWindow) {
-        DockWidget::List result;
-        const auto groups = m_floatingWindow->groups();
-        for (Group *group : groups) {
-            result.append(group->dockWidgets());
-        }
-        return result;
-    }
+    if (m_floatingWindow)
+        return m_floatingWindow->dockWidgets();
 
     if (m_group)
         return m_group->dockWidgets();
@@ -647,6 +641,15 @@ Core::DockWidget::List TitleBar::dockWidgets() const
 
 Core::DockWidget *TitleBar::singleDockWidget() const
 {
+    if (m_floatingWindow) {
+        DockWidget *result = nullptr;
+        m_floatingWindow->layout()->visitDockWidgets([&result](DockWidget *dw) {
+            result = dw;
+            return false;
+        });
+        return result;
+    }
+
     const DockWidget::List dockWidgets = this->dockWidgets();
     return dockWidgets.isEmpty() ? nullptr : dockWidgets.first();
 }
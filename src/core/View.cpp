@@ -68,7 +68,7 @@ View::~View()
         delete m_controller;
     }
 
-#ifdef KDDW_FRONTEND_FLUTTER
+#if defined(KDDW_FRONTEND_FLUTTER) || defined(KDDW_FRONTEND_HEADLESS)
     const auto children = m_childViews;
     for (auto child : children)
         delete child;
@@ -263,7 +263,7 @@ protected:
     View(const View &) = delete;
     View &operator=(const View &) = delete;
 
-#ifdef KDDW_FRONTEND_FLUTTER
+#if defined(KDDW_FRONTEND_FLUTTER) || defined(KDDW_FRONTEND_HEADLESS)
     // Little workaround so flutter has the same deletion order as Qt.
     // In Qt we have this order of deletion
     //    1. ~Core::View() deletes the controller
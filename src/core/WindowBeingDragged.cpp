@@ -22,6 +22,7 @@
 #include "kddockwidgets/core/Platform.h"
 #include "kddockwidgets/core/Layout.h"
 #include "kddockwidgets/core/FloatingWindow.h"
+#include "kddockwidgets/core/DockRegistry.h"
 
 #include <cmath>
 
@@ -109,6 +110,7 @@ void WindowBeingDragged::init()
     assert(m_floatingWindow);
     grabMouse(true);
     m_floatingWindow->view()->raise();
+    DockRegistry::self()->onFloatingWindowRaised(m_floatingWindow);
 }
 
 void WindowBeingDragged::updateTransparency(bool enable)
@@ -139,7 +141,7 @@ void WindowBeingDragged::grabMouse(bool grab)
     if (!m_guard)
         return;
 
-    KDDW_DEBUG("WindowBeingDragged: fw={}, grab={}, draggableView={} ", ( void * )m_floatingWindow, grab, ( void * )m_draggableView);
+    KDDW_CDEBUG(Drag, "WindowBeingDragged: fw={}, grab={}, draggableView={} ", ( void * )m_floatingWindow, grab, ( void * )m_draggableView);
 
     if (grab)
         DragController::instance()->grabMouseFor(m_draggableView);
@@ -149,7 +151,16 @@ void WindowBeingDragged::grabMouse(bool grab)
 
 Vector<QString> WindowBeingDragged::affinities() const
 {
-    return m_floatingWindow ? m_floatingWindow->affinities() : Vector<QString>();
+    return affinitySet().names;
+}
+
+const AffinitySet &WindowBeingDragged::affinitySet() const
+{
+    if (m_floatingWindow)
+        return m_floatingWindow->affinitySet();
+
+    static const AffinitySet s_noAffinities;
+    return s_noAffinities;
 }
 
 Size WindowBeingDragged::size() const
@@ -285,16 +296,17 @@ Pixmap WindowBeingDraggedWayland::pixmap() const
 #endif
 }
 
-Vector<QString> WindowBeingDraggedWayland::affinities() const
+const AffinitySet &WindowBeingDraggedWayland::affinitySet() const
 {
     if (m_floatingWindow)
-        return WindowBeingDragged::affinities();
+        return WindowBeingDragged::affinitySet();
     else if (m_group)
-        return m_group->affinities();
+        return m_group->affinitySet();
     else if (m_dockWidget)
-        return { m_dockWidget->affinities() };
+        return m_dockWidget->affinitySet();
 
-    return {};
+    static const AffinitySet s_noAffinities;
+    return s_noAffinities;
 }
 
 Vector<DockWidget *> WindowBeingDraggedWayland::dockWidgets() const
@@ -52,7 +52,10 @@ public:
     bool contains(Layout *) const;
 
     ///@brief returns the affinities of the window being dragged
-    virtual Vector<QString> affinities() const;
+    Vector<QString> affinities() const;
+
+    ///@brief returns the affinities of the window being dragged, interned for matching
+    virtual const AffinitySet &affinitySet() const;
 
     ///@brief size of the window being dragged contents
     virtual Size size() const;
@@ -104,7 +107,7 @@ public:
     Size minSize() const override;
     Size maxSize() const override;
     Pixmap pixmap() const override;
-    Vector<QString> affinities() const override;
+    const AffinitySet &affinitySet() const override;
     Vector<DockWidget *> dockWidgets() const override;
     bool isInWaylandDrag(Group *) const override;
 
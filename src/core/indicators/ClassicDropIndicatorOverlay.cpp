@@ -35,12 +35,39 @@ createIndicatorWindow(ClassicDropIndicatorOverlay *classicIndicators, Core::View
     return window;
 }
 
+namespace {
+
+/// The indicator window shared by all drop areas when Config::sharedClassicIndicatorWindow()
+/// is enabled. Only one drop area is hovered at a time, so it's handed over to whichever needs it.
+struct SharedIndicatorWindow
+{
+    Core::ClassicIndicatorWindowViewInterface *window = nullptr;
+    ClassicDropIndicatorOverlay *owner = nullptr;
+    int numOverlays = 0;
+};
+
+SharedIndicatorWindow &sharedIndicatorWindow()
+{
+    static SharedIndicatorWindow shared;
+    return shared;
+}
+
+}
+
 ClassicDropIndicatorOverlay::ClassicDropIndicatorOverlay(Core::DropArea *dropArea)
     : DropIndicatorOverlay(dropArea) // Is parented on the drop-area, not a toplevel.
     , m_rubberBand(Config::self().viewFactory()->createRubberBand(
           rubberBandIsTopLevel() ? nullptr : dropArea->view())) // rubber band is parented on the drop area
-    , m_indicatorWindow(createIndicatorWindow(this, dropArea->view())) // a real top-level, transparent window, to hold our indicators
+    , m_usesSharedIndicatorWindow(Config::self().sharedClassicIndicatorWindow())
 {
+    if (m_usesSharedIndicatorWindow) {
+        // Created or handed over on first hover
+        sharedIndicatorWindow().numOverlays++;
+    } else {
+        // a real top-level, transparent window, to hold our indicators
+        m_indicatorWindow = createIndicatorWindow(this, dropArea->view());
+    }
+
     if (rubberBandIsTopLevel())
         m_rubberBand->setWindowOpacity(0.5);
     m_rubberBand->setVisible(false);
@@ -49,47 +76,109 @@ ClassicDropIndicatorOverlay::ClassicDropIndicatorOverlay(Core::DropArea *dropAre
 ClassicDropIndicatorOverlay::~ClassicDropIndicatorOverlay()
 {
     delete m_indicatorWindow;
+
+    if (m_usesSharedIndicatorWindow) {
+        SharedIndicatorWindow &shared = sharedIndicatorWindow();
+        if (shared.owner == this) {
+            shared.owner = nullptr;
+            shared.window->setVisible(false);
+        }
+
+        shared.numOverlays--;
+        if (shared.numOverlays == 0) {
+            delete shared.window;
+            shared.window = nullptr;
+        }
+    }
+}
+
+Core::ClassicIndicatorWindowViewInterface *ClassicDropIndicatorOverlay::acquireIndicatorWindow()
+{
+    if (m_indicatorWindow)
+        return m_indicatorWindow;
+
+    SharedIndicatorWindow &shared = sharedIndicatorWindow();
+    if (shared.owner == this)
+        return shared.window;
+
+    if (shared.window) {
+        if (shared.owner)
+            shared.window->setVisible(false);
+        shared.window->setClassicIndicators(this);
+    } else {
+        auto window = createIndicatorWindow(this, m_dropArea->view());
+        if (!window->setClassicIndicators(this)) {
+            // The frontend doesn't support sharing, keep it for ourselves
+            m_indicatorWindow = window;
+            return window;
+        }
+
+        shared.window = window;
+    }
+
+    shared.owner = this;
+    return shared.window;
 }
 
 DropLocation ClassicDropIndicatorOverlay::hover_impl(Point globalPos)
 {
-    return m_indicatorWindow->hover(globalPos);
+    return acquireIndicatorWindow()->hover(globalPos);
 }
 
 Point ClassicDropIndicatorOverlay::posForIndicator(DropLocation loc) const
 {
-    return m_indicatorWindow->posForIndicator(loc);
+    if (auto window = indicatorWindow())
+        return window->posForIndicator(loc);
+
+    return {};
+}
+
+DropLocation ClassicDropIndicatorOverlay::dropLocationAt(Point globalPos) const
+{
+    if (auto window = indicatorWindow())
+        return window->dropLocationAt(globalPos);
+
+    return DropLocation_None;
 }
 
 bool ClassicDropIndicatorOverlay::onResize(Size)
 {
-    m_indicatorWindow->resize(window()->size());
+    if (auto window = indicatorWindow())
+        window->resize(this->window()->size());
     return false;
 }
 
 void ClassicDropIndicatorOverlay::updateVisibility()
 {
     if (isHovered()) {
-        m_indicatorWindow->updatePositions();
-        m_indicatorWindow->setVisible(true);
+        auto window = acquireIndicatorWindow();
+        window->updatePositions();
+        window->setVisible(true);
         updateWindowPosition();
         raiseIndicators();
     } else {
         m_rubberBand->setVisible(false);
-        m_indicatorWindow->setVisible(false);
+        if (auto window = indicatorWindow())
+            window->setVisible(false);
     }
 
-    m_indicatorWindow->updateIndicatorVisibility();
+    if (auto window = indicatorWindow())
+        window->updateIndicatorVisibility();
 }
 
 Core::ClassicIndicatorWindowViewInterface *ClassicDropIndicatorOverlay::indicatorWindow() const
 {
-    return m_indicatorWindow;
+    if (m_indicatorWindow)
+        return m_indicatorWindow;
+
+    const SharedIndicatorWindow &shared = sharedIndicatorWindow();
+    return shared.owner == this ? shared.window : nullptr;
 }
 
 void ClassicDropIndicatorOverlay::raiseIndicators()
 {
-    m_indicatorWindow->raise();
+    if (auto window = indicatorWindow())
+        window->raise();
 }
 
 KDDockWidgets::Location locationToMultisplitterLocation(DropLocation location)
@@ -176,14 +265,18 @@ void ClassicDropIndicatorOverlay::setCurrentDropLocation(DropLocation location)
 
 void ClassicDropIndicatorOverlay::updateWindowPosition()
 {
+    auto window = indicatorWindow();
+    if (!window)
+        return;
+
     Rect rect = this->rect();
-    if (m_indicatorWindow->isWindow()) {
+    if (window->isWindow()) {
         // On all non-wayland platforms it's a top-level.
 
         const Point pos = m_dropArea->mapToGlobal(Point(0, 0));
         rect.moveTo(pos);
     }
-    m_indicatorWindow->setGeometry(rect);
+    window->setGeometry(rect);
 }
 
 bool ClassicDropIndicatorOverlay::rubberBandIsTopLevel() const
@@ -29,11 +29,15 @@ public:
     ~ClassicDropIndicatorOverlay() override;
     DropLocation hover_impl(Point globalPos) override;
     Point posForIndicator(DropLocation) const override;
+    DropLocation dropLocationAt(Point globalPos) const override;
 
     bool onResize(Size newSize);
     void setCurrentDropLocation(DropLocation) override;
     void updateVisibility() override;
 
+    /// Returns the window holding the indicators.
+    /// With Config::sharedClassicIndicatorWindow() this is nullptr while another drop area is using
+    /// the shared window.
     Core::ClassicIndicatorWindowViewInterface *indicatorWindow() const;
     View *rubberBand() const;
 
@@ -43,9 +47,13 @@ private:
     void raiseIndicators();
     Rect geometryForRubberband(Rect localRect) const;
     void updateWindowPosition();
+    Core::ClassicIndicatorWindowViewInterface *acquireIndicatorWindow();
 
     View *const m_rubberBand;
-    Core::ClassicIndicatorWindowViewInterface *const m_indicatorWindow;
+    const bool m_usesSharedIndicatorWindow;
+
+    /// Our own window. nullptr if we're using the shared one
+    Core::ClassicIndicatorWindowViewInterface *m_indicatorWindow = nullptr;
 };
 
 }
@@ -60,6 +60,11 @@ DropLocation SegmentedDropIndicatorOverlay::dropLocationForPos(Point pos) const
     return DropLocation_None;
 }
 
+DropLocation SegmentedDropIndicatorOverlay::dropLocationAt(Point globalPos) const
+{
+    return dropLocationForPos(view()->mapFromGlobal(globalPos));
+}
+
 std::unordered_map<DropLocation, Polygon> SegmentedDropIndicatorOverlay::segmentsForRect(Rect r, bool inner,
                                                                                          bool useOffset) const
 {
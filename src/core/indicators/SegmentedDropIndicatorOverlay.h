@@ -29,6 +29,7 @@ public:
     DropLocation hover_impl(Point globalPos) override;
 
     DropLocation dropLocationForPos(Point pos) const;
+    DropLocation dropLocationAt(Point globalPos) const override;
     Point hoveredPt() const;
     const std::unordered_map<DropLocation, Polygon> &segments() const;
 
@@ -21,6 +21,7 @@
 #include "core/nlohmann_helpers_p.h"
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <cstdlib>
 #include <utility>
@@ -59,6 +60,43 @@ Size Core::Item::hardcodedMaximumSize = Size(16777215, 16777215);
 bool Core::ItemBoxContainer::s_inhibitSimplify = false;
 LayoutingSeparator *LayoutingSeparator::s_separatorBeingDragged = nullptr;
 
+namespace {
+
+/// See CoalescedGeometryChanges
+int s_geometryCoalescingDepth = 0;
+
+/// Items owing a geometryChanged emission. Deleted items are set to nullptr.
+std::vector<Item *> s_pendingGeometryChanges;
+
+/// The items being flushed right now, so a slot deleting one of them doesn't leave it dangling
+std::vector<Item *> *s_flushingGeometryChanges = nullptr;
+
+/// Items shown during the current coalescing scope. Their guests snap to the final geometry instead
+/// of animating from a stale one. Deleted items are set to nullptr.
+std::vector<Item *> s_itemsBeingShown;
+
+void forgetPendingGeometryChange(std::vector<Item *> &items, Item *item)
+{
+    auto it = std::find(items.begin(), items.end(), item);
+    if (it != items.end())
+        *it = nullptr;
+}
+
+/// Returns the geometry at @p progress, in [0, 1], of a transition from @p from to @p to.
+/// Eases out, so guests start moving fast and settle smoothly.
+Rect interpolatedGeometry(Rect from, Rect to, double progress)
+{
+    const double eased = 1 - std::pow(1 - progress, 3);
+    auto lerp = [eased](int a, int b) {
+        return a + int(std::lround((b - a) * eased));
+    };
+
+    return Rect(lerp(from.x(), to.x()), lerp(from.y(), to.y()),
+                lerp(from.width(), to.width()), lerp(from.height(), to.height()));
+}
+
+}
+
 inline bool locationIsVertical(Location loc)
 {
     return loc == Location_OnTop || loc == Location_OnBottom;
@@ -190,6 +228,9 @@ void Item::setGuest(LayoutingGuest *guest)
 {
     assert(!guest || !m_guest);
 
+    if (guest != m_guest)
+        bumpStructureVersion();
+
     m_guest = guest;
     m_parentChangedConnection.disconnect();
     m_guestDestroyedConnection->disconnect();
@@ -233,8 +274,21 @@ void Item::setGuest(LayoutingGuest *guest)
 
 void Item::updateWidgetGeometries()
 {
-    if (m_guest) {
-        m_guest->setGeometry(mapToRoot(rect()));
+    if (m_guest && !guestGeometryUpdatesSuspended()) {
+        // Transitions are off by default, so check that first, this is called for every guest.
+        // Hidden guests, guests being shown and MDI guests, which the user moves directly, don't animate
+        const bool animate = m_host && m_host->transitionDuration() > 0 && m_isVisible
+            && !m_snapGuestGeometry && !isMDI();
+        setGuestGeometry(mapToRoot(rect()), animate);
+    }
+}
+
+void Item::setGuestGeometry(Rect geometry, bool animate)
+{
+    if (m_host) {
+        m_host->setGuestGeometry(m_guest, geometry, animate);
+    } else {
+        m_guest->setGeometry(geometry);
     }
 }
 
@@ -410,9 +464,13 @@ void Item::setParentContainer(ItemContainer *parent)
     if (parent == m_parent)
         return;
 
+    // Both the old and the new root gain or lose items
+    bumpStructureVersion();
+
     if (m_parent) {
         m_minSizeChangedHandle.disconnect();
         m_visibleChangedHandle.disconnect();
+        recordSignalEmission();
         visibleChanged.emit(this, false);
     }
 
@@ -429,6 +487,7 @@ void Item::setParentContainer(ItemContainer *parent)
     connectParent(parent); // Reused by the ctor too
 
     setParent(parent);
+    bumpStructureVersion();
 }
 
 void Item::connectParent(ItemContainer *parent)
@@ -446,6 +505,7 @@ void Item::connectParent(ItemContainer *parent)
         // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall)
         updateWidgetGeometries();
 
+        recordSignalEmission();
         // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall)
         visibleChanged.emit(this, isVisible());
     }
@@ -507,6 +567,7 @@ void Item::setMinSize(Size sz)
 {
     if (sz != m_sizingInfo.minSize) {
         m_sizingInfo.minSize = sz;
+        recordSignalEmission();
         minSizeChanged.emit(this);
         if (!m_isSettingGuest)
             setSize_recursive(size().expandedTo(sz));
@@ -517,6 +578,7 @@ void Item::setMaxSizeHint(Size sz)
 {
     if (sz != m_sizingInfo.maxSizeHint) {
         m_sizingInfo.maxSizeHint = sz;
+        recordSignalEmission();
         maxSizeChanged.emit(this);
     }
 }
@@ -665,6 +727,8 @@ void Item::setSize(Size sz)
 
 void Item::requestResize(int left, int top, int right, int bottom)
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::Resize);
+    CoalescedGeometryChanges coalesced;
     if (left == 0 && right == 0 && top == 0 && bottom == 0)
         return;
 
@@ -793,11 +857,19 @@ void Item::setIsVisible(bool is)
 {
     if (is != m_isVisible) {
         m_isVisible = is;
+        bumpStructureVersion();
+
+        if (is && s_geometryCoalescingDepth > 0 && !m_snapGuestGeometry) {
+            m_snapGuestGeometry = true;
+            s_itemsBeingShown.push_back(this);
+        }
+        recordSignalEmission();
         visibleChanged.emit(this, is);
     }
 
-    if (is && m_guest) {
-        m_guest->setGeometry(mapToRoot(rect()));
+    if (is && m_guest && !guestGeometryUpdatesSuspended()) {
+        // Was hidden, its last geometry is stale, so don't animate from it
+        setGuestGeometry(mapToRoot(rect()), /*animate=*/false);
         m_guest->setVisible(true); // Only set visible when apply*() ?
     }
 }
@@ -838,7 +910,9 @@ bool Item::checkSanity()
         // Reminder: m_guest->geometry() is in the coordspace of the host widget (DropArea)
         // while Item::m_sizingInfo.geometry is in the coordspace of the parent container
 
-        if (m_guest->geometry() != mapToRoot(rect())) {
+        // A guest being animated only has the correct geometry once its transition ends
+        const bool inTransition = m_host && m_host->isInTransition(m_guest);
+        if (!guestGeometryUpdatesSuspended() && !inTransition && m_guest->geometry() != mapToRoot(rect())) {
             root()->dumpLayout();
             KDDW_ERROR("Guest widget doesn't have correct geometry. m_guest->guestGeometry={}, item.mapToRoot(rect())={}", m_guest->geometry(), mapToRoot(rect()));
             return false;
@@ -858,8 +932,17 @@ bool Item::inSetSize() const
     return m_inSetSize;
 }
 
+void Item::recordSignalEmission() const
+{
+    if (m_host)
+        m_host->recordSignalEmission();
+}
+
 void Item::setGeometry(Rect rect)
 {
+    if (m_host)
+        m_host->recordItemVisited();
+
     Rect &m_geometry = m_sizingInfo.geometry;
 
     if (rect != m_geometry) {
@@ -889,21 +972,116 @@ void Item::setGeometry(Rect rect)
             KDDW_ERROR("Constraints not honoured. this={}, sz={}, min={}, parent={}", ( void * )this, rect.size(), minSz, ( void * )parentContainer());
         }
 
-        geometryChanged.emit();
-
+        GeometryChanges changes;
         if (oldGeo.x() != x())
-            xChanged.emit();
+            changes |= GeometryChange_X;
         if (oldGeo.y() != y())
-            yChanged.emit();
+            changes |= GeometryChange_Y;
         if (oldGeo.width() != width())
-            widthChanged.emit();
+            changes |= GeometryChange_Width;
         if (oldGeo.height() != height())
-            heightChanged.emit();
+            changes |= GeometryChange_Height;
+
+        notifyGeometryChanged(oldGeo, changes);
 
         updateWidgetGeometries();
     }
 }
 
+void Item::notifyGeometryChanged(Rect oldGeometry, GeometryChanges changes)
+{
+    if (s_geometryCoalescingDepth > 0) {
+        if (!m_geometryChangePending) {
+            m_geometryChangePending = true;
+            m_pendingOldGeometry = oldGeometry;
+            m_pendingGeometryChanges = GeometryChanges();
+            s_pendingGeometryChanges.push_back(this);
+        }
+
+        m_pendingGeometryChanges |= changes;
+        return;
+    }
+
+    recordSignalEmission();
+    geometryChanged.emit(oldGeometry, changes);
+
+    if (changes.testFlag(GeometryChange_X) || changes.testFlag(GeometryChange_Y)
+        || changes.testFlag(GeometryChange_AncestorMoved)) {
+        if (auto container = asContainer()) {
+            for (Item *child : container->childItems())
+                child->notifyGeometryChanged(child->geometry(), GeometryChange_AncestorMoved);
+        }
+    }
+}
+
+void Item::notifyAncestorMoved()
+{
+    if (m_geometryChangePending && m_pendingGeometryChanges.testFlag(GeometryChange_AncestorMoved))
+        return; // Already done, including for our descendants
+
+    notifyGeometryChanged(geometry(), GeometryChange_AncestorMoved);
+
+    if (auto container = asContainer()) {
+        for (Item *child : container->childItems())
+            child->notifyAncestorMoved();
+    }
+}
+
+void Item::beginCoalescingGeometryChanges()
+{
+    ++s_geometryCoalescingDepth;
+}
+
+void Item::endCoalescingGeometryChanges()
+{
+    assert(s_geometryCoalescingDepth > 0);
+    if (--s_geometryCoalescingDepth > 0)
+        return;
+
+    for (Item *item : s_itemsBeingShown) {
+        if (item)
+            item->m_snapGuestGeometry = false;
+    }
+    s_itemsBeingShown.clear();
+
+    // Containers which moved take their descendants with them. Done here, once per item, instead of
+    // on every intermediate move. The list grows while iterating, so no range-for.
+    ++s_geometryCoalescingDepth;
+    for (size_t i = 0; i < s_pendingGeometryChanges.size(); ++i) {
+        Item *item = s_pendingGeometryChanges[i];
+        if (!item)
+            continue;
+
+        const GeometryChanges changes = item->m_pendingGeometryChanges;
+        if (changes.testFlag(GeometryChange_X) || changes.testFlag(GeometryChange_Y)
+            || changes.testFlag(GeometryChange_AncestorMoved)) {
+            if (auto container = item->asContainer()) {
+                for (Item *child : container->childItems())
+                    child->notifyAncestorMoved();
+            }
+        }
+    }
+    --s_geometryCoalescingDepth;
+
+    // Slots might start a new coalescing scope, so flush a list of our own
+    std::vector<Item *> items;
+    items.swap(s_pendingGeometryChanges);
+    std::vector<Item *> *previousFlushing = s_flushingGeometryChanges;
+    s_flushingGeometryChanges = &items;
+
+    for (size_t i = 0; i < items.size(); ++i) {
+        Item *item = items[i];
+        if (!item)
+            continue;
+
+        item->m_geometryChangePending = false;
+        item->recordSignalEmission();
+        item->geometryChanged.emit(item->m_pendingOldGeometry, item->m_pendingGeometryChanges);
+    }
+
+    s_flushingGeometryChanges = previousFlushing;
+}
+
 void Item::dumpLayout(int level, bool)
 {
     std::string indent(LAYOUT_DUMP_INDENT * size_t(level), ' ');
@@ -956,6 +1134,15 @@ Item::~Item()
     m_inDtor = true;
     aboutToBeDeleted.emit();
 
+    if (m_geometryChangePending) {
+        forgetPendingGeometryChange(s_pendingGeometryChanges, this);
+        if (s_flushingGeometryChanges)
+            forgetPendingGeometryChange(*s_flushingGeometryChanges, this);
+    }
+
+    if (m_snapGuestGeometry)
+        forgetPendingGeometryChange(s_itemsBeingShown, this);
+
     m_minSizeChangedHandle.disconnect();
     m_visibleChangedHandle.disconnect();
     m_parentChangedConnection.disconnect();
@@ -976,6 +1163,7 @@ void Item::turnIntoPlaceholder()
 void Item::onGuestDestroyed()
 {
     m_guest = nullptr;
+    bumpStructureVersion();
     m_parentChangedConnection.disconnect();
     m_guestDestroyedConnection->disconnect();
 
@@ -1085,6 +1273,21 @@ int Item::visibleCount_recursive() const
     return isVisible() ? 1 : 0;
 }
 
+uint32_t Item::structureVersion() const
+{
+    return m_structureVersion;
+}
+
+void Item::bumpStructureVersion()
+{
+    // Not using root(), as MDI's root is not an ItemBoxContainer
+    Item *top = this;
+    while (top->m_parent)
+        top = top->m_parent;
+
+    ++top->m_structureVersion;
+}
+
 struct ItemBoxContainer::Private
 {
     explicit Private(ItemBoxContainer *qq)
@@ -1100,9 +1303,7 @@ struct ItemBoxContainer::Private
 
     ~Private()
     {
-        for (const auto &sep : std::as_const(m_separators))
-            sep->free();
-        m_separators.clear();
+        deleteSeparators();
     }
 
     // length means height if the container is vertical, otherwise width
@@ -1133,6 +1334,7 @@ struct ItemBoxContainer::Private
     int excessLength() const;
 
     mutable bool m_checkSanityScheduled = false;
+    int m_numGuestGeometrySuspensions = 0;
     Vector<LayoutingSeparator *> m_separators;
     bool m_convertingItemToContainer = false;
     bool m_blockUpdatePercentages = false;
@@ -1399,11 +1601,15 @@ int ItemBoxContainer::indexOfVisibleChild(const Item *item) const
 
 void ItemBoxContainer::restore(Item *child)
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::Restore);
+    CoalescedGeometryChanges coalesced;
     restoreChild(child, false, NeighbourSqueezeStrategy::ImmediateNeighboursFirst);
 }
 
 void ItemBoxContainer::removeItem(Item *item, bool hardRemove)
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::Remove);
+    CoalescedGeometryChanges coalesced;
     assert(!item->isRoot());
 
     if (!contains(item)) {
@@ -1428,8 +1634,11 @@ void ItemBoxContainer::removeItem(Item *item, bool hardRemove)
     if (hardRemove) {
         m_children.removeOne(item);
         delete item;
-        if (!isContainer)
+        bumpStructureVersion();
+        if (!isContainer) {
+            root()->recordSignalEmission();
             root()->numItemsChanged.emit();
+        }
     } else {
         item->setIsVisible(false);
         item->setGuest(nullptr);
@@ -1441,6 +1650,7 @@ void ItemBoxContainer::removeItem(Item *item, bool hardRemove)
     }
 
     if (wasVisible) {
+        root()->recordSignalEmission();
         root()->numVisibleItemsChanged.emit(root()->numVisibleChildren());
     }
 
@@ -1456,6 +1666,7 @@ void ItemBoxContainer::removeItem(Item *item, bool hardRemove)
     } else {
         // Neighbours will occupy the space of the deleted item
         growNeighbours(side1Item, side2Item);
+        recordSignalEmission();
         itemsChanged.emit();
 
         updateSizeConstraints();
@@ -1491,6 +1702,7 @@ ItemBoxContainer *ItemBoxContainer::convertChildToContainer(Item *leaf, const In
         option.visibility = InitialVisibilityOption::StartHidden;
 
     container->insertItem(leaf, Location_OnTop, option);
+    recordSignalEmission();
     itemsChanged.emit();
     d->updateSeparators_recursive();
 
@@ -1502,6 +1714,8 @@ ItemBoxContainer *ItemBoxContainer::convertChildToContainer(Item *leaf, const In
 void ItemBoxContainer::insertItemRelativeTo(Item *item, Item *relativeTo, Location loc,
                                             const KDDockWidgets::InitialOption &option)
 {
+    LayoutProfilingScope profiling(relativeTo->host(), LayoutOperation::Insert);
+    CoalescedGeometryChanges coalesced;
     assert(item != relativeTo);
 
     if (auto asContainer = relativeTo->asBoxContainer()) {
@@ -1542,6 +1756,8 @@ void ItemBoxContainer::insertItemRelativeTo(Item *item, Item *relativeTo, Locati
 void ItemBoxContainer::insertItem(Item *item, Location loc,
                                   const KDDockWidgets::InitialOption &initialOption)
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::Insert);
+    CoalescedGeometryChanges coalesced;
     assert(item != this);
     if (contains(item)) {
         KDDW_ERROR("Item already exists");
@@ -1624,6 +1840,7 @@ void ItemBoxContainer::updateSizeConstraints()
     }
 
     // Our min-size changed, notify our parent, and so on until it reaches root()
+    recordSignalEmission();
     minSizeChanged.emit(this);
 }
 
@@ -1636,8 +1853,10 @@ void ItemBoxContainer::onChildVisibleChanged(Item *, bool visible)
     if (visible && numVisible == 1) {
         // Child became visible and there's only 1 visible child. Meaning there were 0 visible
         // before.
+        recordSignalEmission();
         visibleChanged.emit(this, true);
     } else if (!visible && numVisible == 0) {
+        recordSignalEmission();
         visibleChanged.emit(this, false);
     }
 }
@@ -1646,30 +1865,38 @@ Rect ItemBoxContainer::suggestedDropRect(const Item *item, const Item *relativeT
                                          Location loc) const
 {
     // Returns the drop rect. This is the geometry used by the rubber band when you hover over an
-    // indicator. It's calculated by copying the layout and inserting the item into the
-    // dummy/invisible copy The we see which geometry the item got. This way the returned geometry
+    // indicator. See simulateDrop() for how it's calculated.
+    return simulateDrop(item, relativeTo, loc).dropRect;
+}
+
+DropSimulation ItemBoxContainer::simulateDrop(const Item *item, const Item *relativeTo,
+                                              Location loc) const
+{
+    // The drop is calculated by copying the layout and inserting the item into the
+    // dummy/invisible copy. Then we see which geometry the item got. This way the returned geometry
     // is always what the item will get if you drop it. One exception is if the window doesn't have
     // enough space and it would grow. In this case we fall back to something reasonable
 
+    DropSimulation result;
 
     if (relativeTo && !relativeTo->parentContainer()) {
         KDDW_ERROR("No parent container");
-        return {};
+        return result;
     }
 
     if (relativeTo && relativeTo->parentContainer() != this) {
         KDDW_ERROR("Called on the wrong container");
-        return {};
+        return result;
     }
 
     if (relativeTo && !relativeTo->isVisible()) {
         KDDW_ERROR("relative to isn't visible");
-        return {};
+        return result;
     }
 
     if (loc == Location_None) {
         KDDW_ERROR("Invalid location");
-        return {};
+        return result;
     }
 
     const Size availableSize = root()->availableSize();
@@ -1680,8 +1907,10 @@ Rect ItemBoxContainer::suggestedDropRect(const Item *item, const Item *relativeT
     const bool windowNeedsGrowing = availableSize.width() < minSize.width() + extraWidth
         || availableSize.height() < minSize.height() + extraHeight;
 
-    if (windowNeedsGrowing)
-        return suggestedDropRectFallback(item, relativeTo, loc);
+    if (windowNeedsGrowing) {
+        result.dropRect = suggestedDropRectFallback(item, relativeTo, loc);
+        return result;
+    }
 
     nlohmann::json rootSerialized;
     root()->to_json(rootSerialized);
@@ -1689,8 +1918,7 @@ Rect ItemBoxContainer::suggestedDropRect(const Item *item, const Item *relativeT
     ItemBoxContainer rootCopy(nullptr);
     rootCopy.fillFromJson(rootSerialized, {});
 
-    if (relativeTo)
-        relativeTo = rootCopy.d->itemFromPath(relativeTo->pathFromRoot());
+    const Item *relativeToCopy = relativeTo ? rootCopy.d->itemFromPath(relativeTo->pathFromRoot()) : nullptr;
 
     nlohmann::json itemSerialized;
     item->to_json(itemSerialized);
@@ -1698,8 +1926,8 @@ Rect ItemBoxContainer::suggestedDropRect(const Item *item, const Item *relativeT
     itemCopy->fillFromJson(itemSerialized, {});
 
     const InitialOption opt = DefaultSizeMode::FairButFloor;
-    if (relativeTo) {
-        auto r = const_cast<Item *>(relativeTo);
+    if (relativeToCopy) {
+        auto r = const_cast<Item *>(relativeToCopy);
         ItemBoxContainer::insertItemRelativeTo(itemCopy, r, loc, opt);
     } else {
         rootCopy.insertItem(itemCopy, loc, opt);
@@ -1708,10 +1936,38 @@ Rect ItemBoxContainer::suggestedDropRect(const Item *item, const Item *relativeT
     if (rootCopy.size() != root()->size()) {
         // Doesn't happen
         KDDW_ERROR("The root copy grew ?! copy={}, sz={}, loc={}", rootCopy.size(), root()->size(), loc);
-        return suggestedDropRectFallback(item, relativeTo, loc);
+        result.dropRect = suggestedDropRectFallback(item, relativeTo, loc);
+        return result;
+    }
+
+    result.dropRect = itemCopy->mapToRoot(itemCopy->rect());
+    result.isExact = true;
+
+    return result;
+}
+
+void ItemBoxContainer::suspendGuestGeometryUpdates()
+{
+    assert(isRoot());
+    d->m_numGuestGeometrySuspensions++;
+}
+
+void ItemBoxContainer::resumeGuestGeometryUpdates()
+{
+    if (d->m_numGuestGeometrySuspensions == 0) {
+        KDDW_ERROR("Unbalanced call to resumeGuestGeometryUpdates");
+        return;
     }
 
-    return itemCopy->mapToRoot(itemCopy->rect());
+    d->m_numGuestGeometrySuspensions--;
+    if (d->m_numGuestGeometrySuspensions == 0)
+        d->updateWidgets_recursive();
+}
+
+bool Item::guestGeometryUpdatesSuspended() const
+{
+    auto r = root();
+    return r && r->d->m_numGuestGeometrySuspensions > 0;
 }
 
 // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
@@ -1863,6 +2119,7 @@ void ItemBoxContainer::clear()
     }
     m_children.clear();
     d->deleteSeparators();
+    bumpStructureVersion();
 }
 
 Item *ItemBoxContainer::itemAt(Point p) const
@@ -1923,6 +2180,8 @@ void ItemBoxContainer::setLength_recursive(int length, Qt::Orientation o)
 
 void ItemBoxContainer::insertItem(Item *item, int index, const InitialOption &option)
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::Insert);
+    CoalescedGeometryChanges coalesced;
     const bool containerWasVisible = hasVisibleChildren(true);
 
     if (option.sizeMode != DefaultSizeMode::NoDefaultSizeMode) {
@@ -1954,6 +2213,7 @@ void ItemBoxContainer::insertItem(Item *item, int index, const InitialOption &op
     m_children.insert(index, item);
     item->setParentContainer(this);
 
+    recordSignalEmission();
     itemsChanged.emit();
 
     if (!d->m_convertingItemToContainer && item->isVisible()) {
@@ -1968,8 +2228,11 @@ void ItemBoxContainer::insertItem(Item *item, int index, const InitialOption &op
     if (!d->m_convertingItemToContainer && !s_inhibitSimplify)
         simplify();
 
-    if (shouldEmitVisibleChanged)
+    if (shouldEmitVisibleChanged) {
+        root()->recordSignalEmission();
         root()->numVisibleItemsChanged.emit(root()->numVisibleChildren());
+    }
+    root()->recordSignalEmission();
     root()->numItemsChanged.emit();
 }
 
@@ -2020,12 +2283,14 @@ Size ItemBoxContainer::Private::minSize(const Item::List &items) const
             if (!(item->isVisible() || item->isBeingInserted()))
                 continue;
             numVisible++;
+            // Query once, for nested containers this recurses
+            const Size itemMinSize = item->minSize();
             if (q->isVertical()) {
-                minW = std::max(minW, item->minSize().width());
-                minH += item->minSize().height();
+                minW = std::max(minW, itemMinSize.width());
+                minH += itemMinSize.height();
             } else {
-                minH = std::max(minH, item->minSize().height());
-                minW += item->minSize().width();
+                minH = std::max(minH, itemMinSize.height());
+                minW += itemMinSize.width();
             }
         }
 
@@ -2282,6 +2547,8 @@ bool ItemBoxContainer::hostSupportsHonouringLayoutMinSize() const
 
 void ItemBoxContainer::setSize_recursive(Size newSize, ChildrenResizeStrategy strategy)
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::Resize);
+    CoalescedGeometryChanges coalesced;
     ScopedValueRollback block(d->m_blockUpdatePercentages, true);
 
     const Size minSize = this->minSize();
@@ -2496,6 +2763,8 @@ int ItemBoxContainer::oppositeLength() const
 void ItemBoxContainer::requestSeparatorMove(LayoutingSeparator *separator,
                                             int delta)
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::SeparatorMove);
+    CoalescedGeometryChanges coalesced;
     const auto separatorIndex = d->m_separators.indexOf(separator);
     if (separatorIndex == -1) {
         // Doesn't happen
@@ -2603,6 +2872,8 @@ void ItemBoxContainer::requestSeparatorMove(LayoutingSeparator *separator,
 
 void ItemBoxContainer::requestEqualSize(LayoutingSeparator *separator)
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::SeparatorMove);
+    CoalescedGeometryChanges coalesced;
     const auto separatorIndex = d->m_separators.indexOf(separator);
     if (separatorIndex == -1) {
         // Doesn't happen
@@ -2654,6 +2925,8 @@ void ItemBoxContainer::requestEqualSize(LayoutingSeparator *separator)
 
 void ItemBoxContainer::layoutEqually()
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::Resize);
+    CoalescedGeometryChanges coalesced;
     SizingInfo::List childSizes = sizes();
     if (!childSizes.isEmpty()) {
         layoutEqually(childSizes);
@@ -2739,6 +3012,8 @@ void ItemBoxContainer::layoutEqually(SizingInfo::List &sizes)
 
 void ItemBoxContainer::layoutEqually_recursive()
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::Resize);
+    CoalescedGeometryChanges coalesced;
     layoutEqually();
     for (Item *item : std::as_const(m_children)) {
         if (item->isVisible()) {
@@ -3334,7 +3609,7 @@ void ItemBoxContainer::Private::updateSeparators()
                 newSeparators.push_back(separator);
                 m_separators.removeOne(separator);
             } else {
-                separator = s_createSeparatorFunc(q->host(), m_orientation, q);
+                separator = q->host()->acquireSeparator(m_orientation, q);
                 newSeparators.push_back(separator);
             }
         }
@@ -3364,8 +3639,13 @@ void ItemBoxContainer::Private::updateSeparators()
 
 void ItemBoxContainer::Private::deleteSeparators()
 {
-    for (const auto &sep : std::as_const(m_separators))
-        sep->free();
+    // Separators go back to the host that created them, which might not be our current one
+    for (const auto &sep : std::as_const(m_separators)) {
+        if (sep->m_host)
+            sep->m_host->releaseSeparator(sep);
+        else
+            sep->free();
+    }
     m_separators.clear();
 }
 
@@ -3400,6 +3680,8 @@ int ItemBoxContainer::Private::excessLength() const
 
 void ItemBoxContainer::simplify()
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::Simplify);
+
     // Removes unneeded nesting. For example, a vertical layout doesn't need to have vertical
     // layouts inside. It can simply have the contents of said sub-layouts
 
@@ -3544,6 +3826,8 @@ void ItemBoxContainer::to_json(nlohmann::json &j) const
 void ItemBoxContainer::fillFromJson(const nlohmann::json &j,
                                     const std::unordered_map<QString, LayoutingGuest *> &widgets)
 {
+    LayoutProfilingScope profiling(m_host, LayoutOperation::Restore);
+    CoalescedGeometryChanges coalesced;
     if (!j.is_object()) {
         KDDW_ERROR("Expected a JSON object");
         return;
@@ -3562,6 +3846,8 @@ void ItemBoxContainer::fillFromJson(const nlohmann::json &j,
         m_children.push_back(childItem);
     }
 
+    bumpStructureVersion();
+
     if (isRoot()) {
         updateChildPercentages_recursive();
         if (host()) {
@@ -3572,6 +3858,7 @@ void ItemBoxContainer::fillFromJson(const nlohmann::json &j,
         d->relayoutIfNeeded();
         positionItems_recursive();
 
+        recordSignalEmission();
         minSizeChanged.emit(this);
 #ifdef DOCKS_DEVELOPER_MODE
         if (!checkSanity())
@@ -3876,7 +4163,7 @@ void ItemBoxContainer::Private::updateWidgets_recursive()
         } else {
             if (item->isVisible()) {
                 if (auto guest = item->guest()) {
-                    guest->setGeometry(q->mapToRoot(item->geometry()));
+                    item->setGuestGeometry(q->mapToRoot(item->geometry()), /*animate=*/false);
                     guest->setVisible(true);
                 } else {
                     KDDW_ERROR("visible item doesn't have a guest item=", ( void * )item);
@@ -3993,17 +4280,6 @@ ItemContainer::ItemContainer(LayoutingHost *hostWidget, ItemContainer *parent)
     : Item(true, hostWidget, parent)
     , d(new Private(this))
 {
-    xChanged.connect([this] {
-        for (Item *item : std::as_const(m_children)) {
-            item->xChanged.emit();
-        }
-    });
-
-    yChanged.connect([this] {
-        for (Item *item : std::as_const(m_children)) {
-            item->yChanged.emit();
-        }
-    });
 }
 
 ItemContainer::ItemContainer(LayoutingHost *hostWidget)
@@ -4107,13 +4383,12 @@ Item::List ItemContainer::items_recursive() const
 {
     Item::List items;
     items.reserve(30); // sounds like a good upper number to minimize allocations
-    for (Item *item : std::as_const(m_children)) {
-        if (auto c = item->asContainer()) {
-            items.append(c->items_recursive());
-        } else {
-            items.push_back(item);
-        }
-    }
+
+    // Appends into a single vector instead of allocating one per nested container
+    visitItems_recursive([&items](Item *item) {
+        items.push_back(item);
+        return true;
+    });
 
     return items;
 }
@@ -4164,7 +4439,278 @@ bool ItemContainer::inSetSize() const
     });
 }
 
-LayoutingHost::~LayoutingHost() = default;
+LayoutingHost::~LayoutingHost()
+{
+    clearSeparatorPool();
+}
+
+LayoutingSeparator *LayoutingHost::acquireSeparator(Qt::Orientation orientation, ItemBoxContainer *container)
+{
+    for (auto it = m_separatorPool.begin(); it != m_separatorPool.end(); ++it) {
+        LayoutingSeparator *separator = *it;
+        if (separator->m_orientation == orientation) {
+            m_separatorPool.erase(it);
+            m_separatorPoolStats.pooled = int(m_separatorPool.size());
+            m_separatorPoolStats.reused++;
+            separator->m_parentContainer = container;
+            separator->setPooled(false);
+            return separator;
+        }
+    }
+
+    m_separatorPoolStats.created++;
+    return Item::s_createSeparatorFunc(this, orientation, container);
+}
+
+void LayoutingHost::releaseSeparator(LayoutingSeparator *separator)
+{
+    if (int(m_separatorPool.size()) >= maxPooledSeparators()
+        || separator == LayoutingSeparator::s_separatorBeingDragged) {
+        separator->free();
+        return;
+    }
+
+    separator->setPooled(true);
+    separator->m_parentContainer = nullptr;
+    m_separatorPool.push_back(separator);
+    m_separatorPoolStats.pooled = int(m_separatorPool.size());
+    m_separatorPoolStats.recycled++;
+}
+
+void LayoutingHost::clearSeparatorPool()
+{
+    const auto pool = std::move(m_separatorPool);
+    m_separatorPool.clear();
+    m_separatorPoolStats.pooled = 0;
+
+    for (LayoutingSeparator *separator : pool)
+        separator->free();
+}
+
+SeparatorPoolStats LayoutingHost::separatorPoolStats() const
+{
+    return m_separatorPoolStats;
+}
+
+int LayoutingHost::maxPooledSeparators() const
+{
+    return 0;
+}
+
+void LayoutingHost::setGuestGeometry(LayoutingGuest *guest, Rect geometry, bool animate)
+{
+    Transition *transition = transitionFor(guest);
+    if (!animate || transitionDuration() <= 0) {
+        if (transition)
+            removeTransition(guest);
+        recordGuestGeometryUpdate();
+        guest->setGeometry(geometry);
+        return;
+    }
+
+    if (transition) {
+        if (transition->to == geometry)
+            return;
+
+        // Retarget, starting from wherever the guest is now
+        transition->from = guest->geometry();
+        transition->to = geometry;
+        transition->startTime = std::chrono::steady_clock::now();
+        transition->frame = 0;
+    } else {
+        const Rect current = guest->geometry();
+        if (current == geometry)
+            return;
+
+        if (current.isEmpty()) {
+            // Nothing to animate from
+            recordGuestGeometryUpdate();
+            guest->setGeometry(geometry);
+            return;
+        }
+
+        Transition newTransition;
+        newTransition.guest = guest;
+        newTransition.from = current;
+        newTransition.to = geometry;
+        newTransition.startTime = std::chrono::steady_clock::now();
+
+        // Only forget the guest here, the connections can't be disconnected while being emitted
+        newTransition.guestDestroyedConnection = guest->beingDestroyed.connect([this, guest] {
+            if (Transition *t = transitionFor(guest))
+                t->guest = nullptr;
+        });
+        newTransition.hostChangedConnection = guest->hostChanged.connect([this, guest](LayoutingHost *newHost) {
+            if (newHost == this)
+                return;
+            if (Transition *t = transitionFor(guest))
+                t->guest = nullptr;
+        });
+
+        m_transitions.push_back(std::move(newTransition));
+    }
+
+    if (!m_transitionFrameScheduled) {
+        m_transitionFrameScheduled = true;
+        scheduleTransitionFrame(transitionFrameInterval());
+    }
+}
+
+bool LayoutingHost::isInTransition(const LayoutingGuest *guest) const
+{
+    return const_cast<LayoutingHost *>(this)->transitionFor(guest) != nullptr;
+}
+
+bool LayoutingHost::hasTransitions() const
+{
+    return std::any_of(m_transitions.cbegin(), m_transitions.cend(), [](const Transition &t) {
+        return t.guest != nullptr;
+    });
+}
+
+void LayoutingHost::finishTransitions()
+{
+    // Take them first, as setting the geometry might start new transitions
+    auto transitions = std::move(m_transitions);
+    m_transitions.clear();
+
+    for (Transition &transition : transitions) {
+        if (transition.guest) {
+            LayoutingGuest *guest = std::exchange(transition.guest, nullptr);
+            guest->setGeometry(transition.to);
+        }
+    }
+}
+
+void LayoutingHost::advanceTransitions()
+{
+    m_transitionFrameScheduled = false;
+
+    m_transitions.erase(std::remove_if(m_transitions.begin(), m_transitions.end(), [](const Transition &t) {
+                            return t.guest == nullptr;
+                        }),
+                        m_transitions.end());
+
+    if (m_transitions.empty())
+        return;
+
+    const int interval = std::max(1, transitionFrameInterval());
+    const int numFrames = std::max(1, transitionDuration() / interval);
+    const auto now = std::chrono::steady_clock::now();
+
+    // Setting a geometry can retarget, end or start transitions, so look each one up again
+    std::vector<LayoutingGuest *> guests;
+    guests.reserve(m_transitions.size());
+    for (const Transition &transition : m_transitions)
+        guests.push_back(transition.guest);
+
+    for (LayoutingGuest *guest : guests) {
+        Transition *transition = transitionFor(guest);
+        if (!transition)
+            continue;
+
+        // Skip the frames we were too late for
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - transition->startTime);
+        transition->frame = std::max(transition->frame + 1, int(elapsed.count() / interval));
+
+        if (transition->frame >= numFrames) {
+            const Rect target = transition->to;
+            removeTransition(guest);
+            guest->setGeometry(target);
+        } else {
+            guest->setGeometry(interpolatedGeometry(transition->from, transition->to,
+                                                    double(transition->frame) / numFrames));
+        }
+    }
+
+    if (hasTransitions() && !m_transitionFrameScheduled) {
+        m_transitionFrameScheduled = true;
+        scheduleTransitionFrame(interval);
+    }
+}
+
+int LayoutingHost::transitionDuration() const
+{
+    return 0;
+}
+
+int LayoutingHost::transitionFrameInterval() const
+{
+    return 16;
+}
+
+void LayoutingHost::scheduleTransitionFrame(int)
+{
+}
+
+bool LayoutingHost::profilingEnabled() const
+{
+    return false;
+}
+
+LayoutStatistics LayoutingHost::layoutStatistics() const
+{
+    return m_layoutStatistics;
+}
+
+void LayoutingHost::resetLayoutStatistics()
+{
+    m_layoutStatistics = {};
+}
+
+LayoutProfilingScope::LayoutProfilingScope(LayoutingHost *host, LayoutOperation operation)
+{
+    if (!host || !host->profilingEnabled())
+        return;
+
+    // Part of an outer operation of the same kind, even if another kind is in between
+    LayoutOperationStats *stats = &host->m_layoutStatistics[operation];
+    for (auto scope = host->m_profilingScope; scope; scope = scope->m_parent) {
+        if (scope->m_stats == stats)
+            return;
+    }
+
+    m_host = host;
+    m_parent = host->m_profilingScope;
+    m_stats = stats;
+    m_stats->count++;
+    m_startTime = std::chrono::steady_clock::now();
+    host->m_profilingScope = this;
+}
+
+LayoutProfilingScope::~LayoutProfilingScope()
+{
+    if (!m_host)
+        return;
+
+    const auto elapsed = std::chrono::steady_clock::now() - m_startTime;
+    m_stats->wallTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed - m_nestedTime).count();
+    if (m_parent)
+        m_parent->m_nestedTime += elapsed;
+
+    m_host->m_profilingScope = m_parent;
+}
+
+LayoutingHost::Transition *LayoutingHost::transitionFor(const LayoutingGuest *guest)
+{
+    if (!guest)
+        return nullptr;
+
+    auto it = std::find_if(m_transitions.begin(), m_transitions.end(), [guest](const Transition &t) {
+        return t.guest == guest;
+    });
+
+    return it == m_transitions.end() ? nullptr : &*it;
+}
+
+void LayoutingHost::removeTransition(const LayoutingGuest *guest)
+{
+    m_transitions.erase(std::remove_if(m_transitions.begin(), m_transitions.end(), [guest](const Transition &t) {
+                            return t.guest == guest;
+                        }),
+                        m_transitions.end());
+}
+
 LayoutingSeparator::~LayoutingSeparator() = default;
 
 LayoutingSeparator::LayoutingSeparator(LayoutingHost *host, Qt::Orientation orientation, Core::ItemBoxContainer *container)
@@ -4218,6 +4764,10 @@ void LayoutingSeparator::free()
     delete this;
 }
 
+void LayoutingSeparator::setPooled(bool)
+{
+}
+
 bool LayoutingSeparator::isBeingDragged() const
 {
     return LayoutingSeparator::s_separatorBeingDragged != nullptr;
@@ -16,8 +16,61 @@
 #include "core/Logging_p.h"
 #include "core/Utils_p.h"
 
+#include <algorithm>
+#include <cmath>
+
+using namespace KDDockWidgets;
 using namespace KDDockWidgets::Core;
 
+namespace {
+
+/// Side of a spatial index cell, in pixels. Bigger than most MDI windows' step when moving,
+/// so a move usually only touches a few cells.
+constexpr int CellSize = 256;
+
+int cellCoordinate(int pos)
+{
+    // Rounds towards negative infinity, items can be partially outside of the area
+    return pos >= 0 ? pos / CellSize : -((-pos + CellSize - 1) / CellSize);
+}
+
+uint64_t cellKey(int cellX, int cellY)
+{
+    return (uint64_t(uint32_t(cellX)) << 32) | uint32_t(cellY);
+}
+
+/// How much each cascaded window is offset from the previous one. About a title bar.
+constexpr int CascadeOffset = 30;
+
+int64_t area(Rect r)
+{
+    return r.isEmpty() ? 0 : int64_t(r.width()) * r.height();
+}
+
+/// Returns the number of columns for a grid of @p count items which is about as wide as tall
+int numColumnsFor(int count)
+{
+    return std::max(1, int(std::ceil(std::sqrt(double(count)))));
+}
+
+}
+
+template<typename Func>
+void ItemFreeContainer::forEachCell(Rect rect, Func &&func) const
+{
+    if (rect.isEmpty())
+        return;
+
+    const int left = cellCoordinate(rect.left());
+    const int right = cellCoordinate(rect.right());
+    const int top = cellCoordinate(rect.top());
+    const int bottom = cellCoordinate(rect.bottom());
+    for (int x = left; x <= right; ++x) {
+        for (int y = top; y <= bottom; ++y)
+            func(cellKey(x, y));
+    }
+}
+
 ItemFreeContainer::ItemFreeContainer(LayoutingHost *hostWidget, ItemContainer *parent)
     : ItemContainer(hostWidget, parent)
 {
@@ -30,10 +83,13 @@ ItemFreeContainer::ItemFreeContainer(LayoutingHost *hostWidget)
 
 ItemFreeContainer::~ItemFreeContainer()
 {
+    clearIndexes();
 }
 
 void ItemFreeContainer::addDockWidget(Item *item, Point localPt)
 {
+    LayoutProfilingScope profiling(host(), LayoutOperation::Insert);
+
     assert(item != this);
     if (contains(item)) {
         KDDW_ERROR("Item already exists");
@@ -44,36 +100,50 @@ void ItemFreeContainer::addDockWidget(Item *item, Point localPt)
     m_children.append(item);
     item->setParentContainer(this);
     item->setPos(localPt);
+    addToIndexes(item);
 
+    recordSignalEmission();
     itemsChanged.emit();
 
-    if (item->isVisible())
+    if (item->isVisible()) {
+        recordSignalEmission();
         numVisibleItemsChanged.emit(numVisibleChildren());
+    }
 
+    recordSignalEmission();
     numItemsChanged.emit();
 }
 
 void ItemFreeContainer::clear()
 {
+    clearIndexes();
     deleteAll(m_children);
     m_children.clear();
+    bumpStructureVersion();
 }
 
 void ItemFreeContainer::removeItem(Item *item, bool hardRemove)
 {
+    LayoutProfilingScope profiling(host(), LayoutOperation::Remove);
+
     const bool wasVisible = item->isVisible();
 
     if (hardRemove) {
+        removeFromIndexes(item);
         m_children.removeOne(item);
         delete item;
+        bumpStructureVersion();
     } else {
         item->setIsVisible(false);
         item->setGuest(nullptr);
     }
 
-    if (wasVisible)
+    if (wasVisible) {
+        recordSignalEmission();
         numVisibleItemsChanged.emit(numVisibleChildren());
+    }
 
+    recordSignalEmission();
     itemsChanged.emit();
 }
 
@@ -91,3 +161,316 @@ void ItemFreeContainer::onChildVisibleChanged(Item *, bool)
 {
     // Nothing needed to do in this layout type
 }
+
+Item *ItemFreeContainer::itemForView(const LayoutingGuest *guest) const
+{
+    if (!guest)
+        return nullptr;
+
+    const uint32_t version = topLevelStructureVersion();
+    if (!m_itemsByGuestValid || m_itemsByGuestVersion != version) {
+        // Guests only change along with the structure version, so moves and resizes reuse the hash
+        m_itemsByGuest.clear();
+        for (Item *item : std::as_const(m_children)) {
+            if (auto c = item->asContainer()) {
+                // Not used by MDI, but keep the base class semantics
+                c->visitItems_recursive([this](Item *nested) {
+                    if (nested->guest())
+                        m_itemsByGuest.emplace(nested->guest(), nested);
+                    return true;
+                });
+            } else if (item->guest()) {
+                m_itemsByGuest.emplace(item->guest(), item);
+            }
+        }
+
+        m_itemsByGuestVersion = version;
+        m_itemsByGuestValid = true;
+    }
+
+    auto it = m_itemsByGuest.find(guest);
+    return it == m_itemsByGuest.cend() ? nullptr : it->second;
+}
+
+void ItemFreeContainer::raise(Item *item)
+{
+    auto it = m_entries.find(item);
+    if (it == m_entries.end()) {
+        KDDW_ERROR("ItemFreeContainer::raise: Unknown item {}", ( void * )item);
+        return;
+    }
+
+    Entry &entry = it->second;
+    m_zOrder.splice(m_zOrder.end(), m_zOrder, entry.zOrderPos);
+    entry.stackingKey = ++m_nextStackingKey;
+}
+
+Item::List ItemFreeContainer::zOrderedItems() const
+{
+    Item::List items;
+    items.reserve(int(m_zOrder.size()));
+    for (Item *item : m_zOrder)
+        items.push_back(item);
+
+    return items;
+}
+
+Item::List ItemFreeContainer::itemsIntersecting(Rect rect) const
+{
+    std::vector<Item *> candidates;
+    forEachCell(rect, [this, &candidates](uint64_t key) {
+        auto it = m_cells.find(key);
+        if (it != m_cells.cend())
+            candidates.insert(candidates.end(), it->second.cbegin(), it->second.cend());
+    });
+
+    // Items spanning several cells show up more than once
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                    [rect](Item *item) {
+                                        return !item->isVisible() || !item->geometry().intersects(rect);
+                                    }),
+                     candidates.end());
+
+    std::sort(candidates.begin(), candidates.end(), [this](Item *a, Item *b) {
+        return m_entries.at(a).stackingKey > m_entries.at(b).stackingKey;
+    });
+
+    Item::List result;
+    result.reserve(int(candidates.size()));
+    for (Item *item : candidates)
+        result.push_back(item);
+
+    return result;
+}
+
+Item *ItemFreeContainer::itemAt(Point localPt) const
+{
+    const Item::List items = itemsIntersecting(Rect(localPt, Size(1, 1)));
+    return items.isEmpty() ? nullptr : items.first();
+}
+
+void ItemFreeContainer::addToIndexes(Item *item)
+{
+    if (m_entries.find(item) != m_entries.end())
+        return;
+
+    Entry &entry = m_entries[item];
+    entry.zOrderPos = m_zOrder.insert(m_zOrder.end(), item);
+    entry.stackingKey = ++m_nextStackingKey;
+    updateCells(item, entry);
+
+    // With coalescing, geometryChanged might arrive late, so Entry::indexedGeometry is what we trust
+    entry.geometryConnection = item->geometryChanged.connect([this, item] {
+        auto it = m_entries.find(item);
+        if (it != m_entries.end())
+            updateCells(item, it->second);
+    });
+}
+
+void ItemFreeContainer::removeFromIndexes(Item *item)
+{
+    auto it = m_entries.find(item);
+    if (it == m_entries.end())
+        return;
+
+    Entry &entry = it->second;
+    removeFromCells(item, entry.indexedGeometry);
+    m_zOrder.erase(entry.zOrderPos);
+    m_entries.erase(it);
+}
+
+void ItemFreeContainer::updateCells(Item *item, Entry &entry)
+{
+    const Rect newGeometry = item->geometry();
+    if (newGeometry == entry.indexedGeometry)
+        return;
+
+    removeFromCells(item, entry.indexedGeometry);
+
+    forEachCell(newGeometry, [this, item](uint64_t key) {
+        m_cells[key].push_back(item);
+    });
+
+    entry.indexedGeometry = newGeometry;
+}
+
+void ItemFreeContainer::removeFromCells(Item *item, Rect indexedGeometry)
+{
+    forEachCell(indexedGeometry, [this, item](uint64_t key) {
+        auto cellIt = m_cells.find(key);
+        if (cellIt == m_cells.end())
+            return;
+
+        auto &items = cellIt->second;
+        items.erase(std::remove(items.begin(), items.end(), item), items.end());
+        if (items.empty())
+            m_cells.erase(cellIt);
+    });
+}
+
+void ItemFreeContainer::clearIndexes()
+{
+    m_entries.clear();
+    m_zOrder.clear();
+    m_cells.clear();
+    m_itemsByGuest.clear();
+    m_itemsByGuestValid = false;
+}
+
+uint32_t ItemFreeContainer::topLevelStructureVersion() const
+{
+    const Item *top = this;
+    while (top->parentContainer())
+        top = top->parentContainer();
+
+    return top->structureVersion();
+}
+
+Vector<Rect> ItemFreeContainer::arrangedGeometries(MDIArrangement arrangement, const Item::List &items) const
+{
+    Vector<Rect> geometries;
+    const int count = items.size();
+    if (count == 0)
+        return geometries;
+
+    geometries.reserve(count);
+    const Size available = size();
+
+    switch (arrangement) {
+    case MDIArrangement::Tile: {
+        const int columns = numColumnsFor(count);
+        const int rows = (count + columns - 1) / columns;
+        const int rowHeight = available.height() / rows;
+        for (int i = 0; i < count; ++i) {
+            const int row = i / columns;
+            const int column = i % columns;
+
+            // The last row might have fewer items, which then get wider
+            const int itemsInRow = row == rows - 1 ? count - columns * (rows - 1) : columns;
+            const int columnWidth = available.width() / itemsInRow;
+
+            // The last column and row absorb the rounding remainder
+            const int width = column == itemsInRow - 1 ? available.width() - column * columnWidth : columnWidth;
+            const int height = row == rows - 1 ? available.height() - row * rowHeight : rowHeight;
+
+            const Size sz = Size(width, height).expandedTo(items.at(i)->minSize());
+            geometries.push_back(Rect(Point(column * columnWidth, row * rowHeight), sz));
+        }
+        break;
+    }
+    case MDIArrangement::Cascade: {
+        const Size preferred(available.width() * 2 / 3, available.height() * 2 / 3);
+        for (int i = 0; i < count; ++i) {
+            const Size sz = preferred.expandedTo(items.at(i)->minSize());
+
+            // Start over at the top-left once the next step wouldn't fit
+            const int stepsX = std::max(0, available.width() - sz.width()) / CascadeOffset;
+            const int stepsY = std::max(0, available.height() - sz.height()) / CascadeOffset;
+            const int step = i % (std::min(stepsX, stepsY) + 1);
+
+            geometries.push_back(Rect(Point(step * CascadeOffset, step * CascadeOffset), sz));
+        }
+        break;
+    }
+    case MDIArrangement::Masonry: {
+        const int columns = std::min(count, numColumnsFor(count));
+        const int columnWidth = available.width() / columns;
+        std::vector<int> columnHeights(size_t(columns), 0);
+
+        for (int i = 0; i < count; ++i) {
+            Item *item = items.at(i);
+            const Size current = item->size();
+            const int height = current.width() > 0 ? current.height() * columnWidth / current.width() : current.height();
+
+            // Shortest column first, leftmost on ties
+            const auto shortest = std::min_element(columnHeights.begin(), columnHeights.end());
+            const int column = int(shortest - columnHeights.begin());
+
+            const Size sz = Size(columnWidth, height).expandedTo(item->minSize());
+            geometries.push_back(Rect(Point(column * columnWidth, *shortest), sz));
+            *shortest += sz.height();
+        }
+
+        // Squeeze vertically if the tallest column doesn't fit
+        const int tallest = *std::max_element(columnHeights.cbegin(), columnHeights.cend());
+        if (tallest > available.height() && tallest > 0) {
+            for (int i = 0; i < count; ++i) {
+                Rect &geo = geometries[i];
+                const int y = int(int64_t(geo.y()) * available.height() / tallest);
+                const int height = int(int64_t(geo.height()) * available.height() / tallest);
+                geo = Rect(Point(geo.x(), y), Size(geo.width(), height).expandedTo(items.at(i)->minSize()));
+            }
+        }
+        break;
+    }
+    }
+
+    return geometries;
+}
+
+void ItemFreeContainer::arrange(MDIArrangement arrangement)
+{
+    LayoutProfilingScope profiling(host(), LayoutOperation::Resize);
+
+    Item::List items;
+    items.reserve(int(m_zOrder.size()));
+    for (Item *item : m_zOrder) {
+        if (item->isVisible())
+            items.push_back(item);
+    }
+
+    const Vector<Rect> geometries = arrangedGeometries(arrangement, items);
+
+    // Listeners see one geometryChanged per item, once everything is in place
+    CoalescedGeometryChanges coalesced;
+    for (int i = 0; i < items.size(); ++i)
+        items.at(i)->setGeometry(geometries.at(i));
+}
+
+Point ItemFreeContainer::suggestedPosition(Size sz) const
+{
+    const Size available = size();
+    const int maxX = std::max(0, available.width() - sz.width());
+    const int maxY = std::max(0, available.height() - sz.height());
+
+    // Good candidates are the top-left corner and positions touching the existing items
+    std::vector<int> xs = { 0 };
+    std::vector<int> ys = { 0 };
+    for (const auto &it : m_entries) {
+        Item *item = it.first;
+        if (!item->isVisible())
+            continue;
+
+        const Rect geo = item->geometry();
+        xs.push_back(std::min(geo.x() + geo.width(), maxX));
+        ys.push_back(std::min(geo.y() + geo.height(), maxY));
+    }
+
+    std::sort(xs.begin(), xs.end());
+    xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+    Point best;
+    int64_t bestOverlap = -1;
+    for (int y : ys) {
+        for (int x : xs) {
+            const Rect candidate(Point(x, y), sz);
+            int64_t overlap = 0;
+            for (Item *item : itemsIntersecting(candidate))
+                overlap += area(item->geometry().intersected(candidate));
+
+            if (bestOverlap == -1 || overlap < bestOverlap) {
+                best = candidate.topLeft();
+                bestOverlap = overlap;
+                if (overlap == 0)
+                    return best; // Can't do better, and the order prefers top-left
+            }
+        }
+    }
+
+    return best;
+}
@@ -16,6 +16,11 @@
 #include "kddockwidgets/KDDockWidgets.h"
 #include "Item_p.h"
 
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
 namespace KDDockWidgets::Core {
 
 class LayoutingHost;
@@ -25,7 +30,12 @@ class LayoutingHost;
 /// This is unlike ItemBoxContainer, which is used for the default/traditional vertical/horizontal
 /// layouting with nesting.
 ///
-/// This free layout can be used to implement MDI style windows
+/// This free layout can be used to implement MDI style windows.
+///
+/// Keeps a few indexes so that MDI workspaces with many windows stay cheap to move and resize in:
+/// - guest to item, rebuilt lazily whenever structureVersion() changes
+/// - the z-order of the children, where raising is O(1)
+/// - a uniform grid over the children's geometry, for overlap queries
 class DOCKS_EXPORT_FOR_UNIT_TESTS ItemFreeContainer : public ItemContainer
 {
 public:
@@ -43,6 +53,69 @@ public:
     void restore(Item *child) override;
     void onChildMinSizeChanged(Item *child) override;
     void onChildVisibleChanged(Item *child, bool visible) override;
+    Item *itemForView(const LayoutingGuest *) const override;
+
+    /// @brief Puts @p item on top of its siblings
+    void raise(Item *item);
+
+    /// @brief Returns the children, from bottom to top
+    Item::List zOrderedItems() const;
+
+    /// @brief Returns the visible children intersecting @p rect, from top to bottom
+    /// @p rect is in the container's coordinates
+    Item::List itemsIntersecting(Rect rect) const;
+
+    /// @brief Returns the top-most visible child at @p localPt, if any
+    Item *itemAt(Point localPt) const;
+
+    /// @brief Returns the geometry each of @p items would get with @p arrangement, in one pass
+    /// Doesn't change anything. Items are arranged in the order they're passed.
+    Vector<Rect> arrangedGeometries(MDIArrangement arrangement, const Item::List &items) const;
+
+    /// @brief Arranges the visible children, bottom-most first, as a single batched geometry update
+    void arrange(MDIArrangement arrangement);
+
+    /// @brief Returns where a new child of size @p size overlaps the existing ones the least
+    /// Prefers top-left positions when there's a tie, for example when there's free space.
+    Point suggestedPosition(Size size) const;
+
+private:
+    struct Entry
+    {
+        /// Position in m_zOrder
+        std::list<Item *>::iterator zOrderPos;
+
+        /// Higher is more on top. Allows sorting query results without walking m_zOrder.
+        uint64_t stackingKey = 0;
+
+        /// The geometry the item is indexed with in m_cells
+        Rect indexedGeometry;
+
+        KDBindings::ScopedConnection geometryConnection;
+    };
+
+    void addToIndexes(Item *);
+    void removeFromIndexes(Item *);
+    void updateCells(Item *item, Entry &);
+    void removeFromCells(Item *item, Rect indexedGeometry);
+    void clearIndexes();
+
+    template<typename Func>
+    void forEachCell(Rect rect, Func &&func) const;
+
+    uint32_t topLevelStructureVersion() const;
+
+    /// Bottom to top
+    std::list<Item *> m_zOrder;
+    std::unordered_map<Item *, Entry> m_entries;
+    uint64_t m_nextStackingKey = 0;
+
+    /// Grid cell to the items overlapping it
+    std::unordered_map<uint64_t, std::vector<Item *>> m_cells;
+
+    mutable std::unordered_map<const LayoutingGuest *, Item *> m_itemsByGuest;
+    mutable uint32_t m_itemsByGuestVersion = 0;
+    mutable bool m_itemsByGuestValid = false;
 };
 
 }
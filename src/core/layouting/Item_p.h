@@ -17,6 +17,7 @@
 #include "kdbindings/signal.h"
 #include "nlohmann/json.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 
@@ -74,6 +75,17 @@ enum LayoutBorderLocation {
 };
 Q_DECLARE_FLAGS(LayoutBorderLocations, LayoutBorderLocation)
 
+/// What changed in an Item::geometryChanged emission
+enum GeometryChange {
+    GeometryChange_None = 0,
+    GeometryChange_X = 1,
+    GeometryChange_Y = 2,
+    GeometryChange_Width = 4,
+    GeometryChange_Height = 8,
+    GeometryChange_AncestorMoved = 16, ///< An ancestor container moved, so mapToRoot() changed
+};
+Q_DECLARE_FLAGS(GeometryChanges, GeometryChange)
+
 inline int pos(Point p, Qt::Orientation o)
 {
     return o == Qt::Vertical ? p.y() : p.x();
@@ -181,6 +193,18 @@ struct DOCKS_EXPORT SizingInfo
     bool isBeingInserted = false;
 };
 
+/// The outcome of simulating a drop in a headless copy of a layout
+/// @sa ItemBoxContainer::simulateDrop()
+struct DropSimulation
+{
+    /// The geometry the dropped item would get, in root coordinates
+    Rect dropRect;
+
+    /// false if the simulation couldn't run, for example because the window would need to grow.
+    /// dropRect is then only a reasonable approximation.
+    bool isExact = false;
+};
+
 class DOCKS_EXPORT Item : public Core::Object
 {
     Q_OBJECT
@@ -282,6 +306,13 @@ public:
     bool isMDI() const;
     virtual bool inSetSize() const;
 
+    /// Returns whether our root container is deferring guest geometry updates
+    bool guestGeometryUpdatesSuspended() const;
+
+    /// Returns a counter that the root item bumps whenever a leaf item is added, removed, shown,
+    /// hidden or gets another guest. Lets Layout cache its counts instead of walking the tree.
+    uint32_t structureVersion() const;
+
     static bool s_silenceSanityChecks;
 
     Item *outermostNeighbor(Location, bool visibleOnly = true) const;
@@ -308,11 +339,13 @@ public:
     static void setDumpScreenInfoFunc(DumpScreenInfoFunc);
     static void setCreateSeparatorFunc(CreateSeparatorFunc);
 
-    KDBindings::Signal<> geometryChanged;
-    KDBindings::Signal<> xChanged;
-    KDBindings::Signal<> yChanged;
-    KDBindings::Signal<> widthChanged;
-    KDBindings::Signal<> heightChanged;
+    /// @sa CoalescedGeometryChanges
+    static void beginCoalescingGeometryChanges();
+    static void endCoalescingGeometryChanges();
+
+    /// Emitted with the previous geometry and what changed.
+    /// Inside a CoalescedGeometryChanges scope, each item emits at most once, when the scope ends.
+    KDBindings::Signal<Rect, GeometryChanges> geometryChanged;
     KDBindings::Signal<Core::Item *, bool> visibleChanged;
     KDBindings::Signal<Core::Item *> minSizeChanged;
     KDBindings::Signal<Core::Item *> maxSizeChanged;
@@ -335,9 +368,19 @@ public:
     int availableLength(Qt::Orientation) const;
     Size missingSize() const;
     virtual void updateWidgetGeometries();
+    /// Sets the guest's geometry through the host, which animates it if @p animate and transitions are enabled
+    void setGuestGeometry(Rect geometry, bool animate);
     virtual void setIsVisible(bool);
     bool isBeingInserted() const;
     void setBeingInserted(bool);
+    void bumpStructureVersion();
+    void notifyGeometryChanged(Rect oldGeometry, GeometryChanges);
+
+    /// Marks this item and its descendants as moved along with an ancestor
+    void notifyAncestorMoved();
+
+    /// Counts a signal emission in the host's LayoutStatistics
+    void recordSignalEmission() const;
 
     SizingInfo m_sizingInfo;
     const bool m_isContainer;
@@ -351,10 +394,21 @@ private:
     friend class ItemContainer;
     friend class ItemBoxContainer;
     friend class ItemFreeContainer;
+    friend class LayoutingHost;
     int m_refCount = 0;
     void onGuestDestroyed();
     bool m_isVisible = false;
     bool m_inSetSize = false;
+    uint32_t m_structureVersion = 0;
+
+    /// The geometryChanged emission this item owes, while coalescing
+    bool m_geometryChangePending = false;
+    Rect m_pendingOldGeometry;
+    GeometryChanges m_pendingGeometryChanges;
+
+    /// Shown during the current coalescing scope, so the guest doesn't animate yet
+    bool m_snapGuestGeometry = false;
+
     LayoutingHost *m_host = nullptr;
     LayoutingGuest *m_guest = nullptr;
     static DumpScreenInfoFunc s_dumpScreenInfoFunc;
@@ -389,9 +443,27 @@ public:
     int indexOfChild(const Item *child) const;
     bool isEmpty() const;
     bool contains(const Item *item) const;
-    Item *itemForView(const LayoutingGuest *) const;
+    virtual Item *itemForView(const LayoutingGuest *) const;
     Item::List visibleChildren(bool includeBeingInserted = false) const;
     Item::List items_recursive() const;
+
+    /// Calls @p visitor for each leaf item, depth-first, without allocating.
+    /// Stops as soon as @p visitor returns false. Returns false if it was stopped.
+    template<typename Visitor>
+    bool visitItems_recursive(Visitor &&visitor) const
+    {
+        for (Item *item : m_children) {
+            if (auto c = item->asContainer()) {
+                if (!c->visitItems_recursive(visitor))
+                    return false;
+            } else if (!visitor(item)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     bool contains_recursive(const Item *item) const;
     int visibleCount_recursive() const override;
     int count_recursive() const;
@@ -453,6 +525,17 @@ public:
     bool hostSupportsHonouringLayoutMinSize() const;
     Rect suggestedDropRect(const Item *item, const Item *relativeTo,
                            KDDockWidgets::Location) const;
+
+    /// Like suggestedDropRect() but also tells whether the simulation was exact
+    DropSimulation simulateDrop(const Item *item, const Item *relativeTo,
+                                KDDockWidgets::Location) const;
+
+    /// While suspended, leaf items of this layout won't forward geometry changes to their guests.
+    /// When the last suspension is lifted, each visible guest gets its final geometry in a
+    /// single pass. Only valid to call on the root container.
+    /// @sa DeferredGuestGeometry, Item::guestGeometryUpdatesSuspended()
+    void suspendGuestGeometryUpdates();
+    void resumeGuestGeometryUpdates();
     void to_json(nlohmann::json &) const override;
     void fillFromJson(const nlohmann::json &,
                       const std::unordered_map<QString, LayoutingGuest *> &) override;
@@ -624,6 +707,45 @@ struct AtomicSanityChecks
     KDDW_DELETE_COPY_CTOR(AtomicSanityChecks)
 };
 
+/// Coalesces Item::geometryChanged while in scope, for all layouts.
+/// Each item emits once when the outermost scope ends, instead of once per intermediate geometry.
+/// A container that moves no longer re-emits for each descendant on every step either.
+struct CoalescedGeometryChanges
+{
+    CoalescedGeometryChanges()
+    {
+        Item::beginCoalescingGeometryChanges();
+    }
+
+    ~CoalescedGeometryChanges()
+    {
+        Item::endCoalescingGeometryChanges();
+    }
+
+    KDDW_DELETE_COPY_CTOR(CoalescedGeometryChanges)
+};
+
+/// Suspends guest geometry updates for the layout rooted at @p root while in scope.
+/// Useful for operations which would otherwise resize the same guest several times, like a drop.
+struct DeferredGuestGeometry
+{
+    explicit DeferredGuestGeometry(ItemBoxContainer *root)
+        : m_root(root)
+    {
+        if (m_root)
+            m_root->suspendGuestGeometryUpdates();
+    }
+
+    ~DeferredGuestGeometry()
+    {
+        if (m_root)
+            m_root->resumeGuestGeometryUpdates();
+    }
+
+    ItemBoxContainer *const m_root;
+    KDDW_DELETE_COPY_CTOR(DeferredGuestGeometry)
+};
+
 DOCKS_EXPORT void from_json(const nlohmann::json &, SizingInfo &);
 DOCKS_EXPORT void to_json(nlohmann::json &, const SizingInfo &);
 DOCKS_EXPORT void to_json(nlohmann::json &, Item *);
@@ -14,12 +14,33 @@
 #include "kddockwidgets/docks_export.h"
 #include "kddockwidgets/KDDockWidgets.h"
 
+#include <kdbindings/signal.h>
+
+#include <chrono>
+#include <vector>
+
 namespace KDDockWidgets {
 
 namespace Core {
 
 class LayoutingGuest;
+class LayoutingSeparator;
+class LayoutProfilingScope;
 class ItemContainer;
+class ItemBoxContainer;
+
+/// Counters describing how a LayoutingHost's separator pool is being used
+struct SeparatorPoolStats
+{
+    /// How many separators were created because the pool had none to offer
+    int created = 0;
+    /// How many separators were taken from the pool instead of being created
+    int reused = 0;
+    /// How many separators were put back into the pool instead of being freed
+    int recycled = 0;
+    /// How many separators are currently sitting in the pool
+    int pooled = 0;
+};
 
 /// The interface graphical components need to implement in order to host a layout
 /// The layout engine doesn't know about any GUI, only about LayoutingHost.
@@ -45,13 +66,140 @@ public:
     void insertItemRelativeTo(Core::LayoutingGuest *guest, Core::LayoutingGuest *relativeTo, Location loc,
                               const InitialOption &initialOption = {});
 
+    /// Returns a separator for @p container, reusing a pooled one of the same orientation if any.
+    /// Otherwise creates one via Item::s_createSeparatorFunc.
+    Core::LayoutingSeparator *acquireSeparator(Qt::Orientation, Core::ItemBoxContainer *container);
+
+    /// Hides @p separator and keeps it for reuse, or frees it if the pool is full.
+    void releaseSeparator(Core::LayoutingSeparator *separator);
+
+    /// Frees all pooled separators
+    void clearSeparatorPool();
+
+    /// Returns the separator pool's counters, mostly for tests and profiling
+    SeparatorPoolStats separatorPoolStats() const;
+
+    /// The maximum number of unused separators kept around for reuse.
+    /// Default is 0, which disables pooling.
+    virtual int maxPooledSeparators() const;
+
+    /// Sets @p guest's geometry. When transitions are enabled and @p animate is true, the guest
+    /// is instead moved towards @p geometry over the next frames.
+    /// A guest already in transition is retargeted, starting from where it currently is.
+    void setGuestGeometry(Core::LayoutingGuest *guest, Rect geometry, bool animate = true);
+
+    /// Returns whether @p guest is being animated towards its final geometry
+    bool isInTransition(const Core::LayoutingGuest *guest) const;
+
+    /// Returns whether any guest is being animated
+    bool hasTransitions() const;
+
+    /// Moves all guests to their final geometry, ending their transitions
+    void finishTransitions();
+
+    /// Applies the next frame of the running transitions.
+    /// Called by the host after the delay passed to scheduleTransitionFrame().
+    /// If frames ran late, the ones which should have been shown meanwhile are skipped.
+    void advanceTransitions();
+
+    /// How long a transition lasts, in ms.
+    /// Default is 0, which disables transitions.
+    virtual int transitionDuration() const;
+
+    /// The interval between two frames of a transition, in ms. Default is 16.
+    virtual int transitionFrameInterval() const;
+
+    /// Asks the host to call advanceTransitions() in @p ms.
+    /// The default implementation doesn't schedule anything, so transitions need a host overriding it.
+    virtual void scheduleTransitionFrame(int ms);
+
+    /// Whether the cost of layout operations is recorded, see LayoutProfilingScope.
+    /// Default is false.
+    virtual bool profilingEnabled() const;
+
+    /// Returns the cost recorded so far for each kind of operation
+    LayoutStatistics layoutStatistics() const;
+    void resetLayoutStatistics();
+
+    /// Called by the layouting engine, these add to the operation being profiled, if any
+    void recordItemVisited();
+    void recordGuestGeometryUpdate();
+    void recordSignalEmission();
+
     Core::ItemContainer *m_rootItem = nullptr;
 
 private:
+    struct Transition
+    {
+        Core::LayoutingGuest *guest = nullptr;
+        Rect from;
+        Rect to;
+        std::chrono::steady_clock::time_point startTime;
+        int frame = 0;
+        KDBindings::ScopedConnection guestDestroyedConnection;
+        KDBindings::ScopedConnection hostChangedConnection;
+    };
+
+    Transition *transitionFor(const Core::LayoutingGuest *guest);
+    void removeTransition(const Core::LayoutingGuest *guest);
+
+    std::vector<Transition> m_transitions;
+    bool m_transitionFrameScheduled = false;
+
+    friend class LayoutProfilingScope;
+    LayoutStatistics m_layoutStatistics;
+
+    /// The innermost operation being profiled
+    LayoutProfilingScope *m_profilingScope = nullptr;
+
+    Vector<Core::LayoutingSeparator *> m_separatorPool;
+    SeparatorPoolStats m_separatorPoolStats;
+
     LayoutingHost(const LayoutingHost &) = delete;
     LayoutingHost &operator=(const LayoutingHost &) = delete;
 };
 
+/// Attributes the work the layouting engine does while in scope to @p operation, in @p host's
+/// LayoutStatistics. Does nothing if @p host isn't profiling.
+/// A nested scope of the same kind as any enclosing one is part of it, even with scopes of another
+/// kind in between. A nested scope of another kind gets its own share, which is subtracted from the
+/// outer one's wall time.
+class DOCKS_EXPORT LayoutProfilingScope
+{
+public:
+    LayoutProfilingScope(LayoutingHost *host, LayoutOperation operation);
+    ~LayoutProfilingScope();
+
+private:
+    friend class LayoutingHost;
+    LayoutingHost *m_host = nullptr;
+    LayoutProfilingScope *m_parent = nullptr;
+    LayoutOperationStats *m_stats = nullptr;
+    std::chrono::steady_clock::time_point m_startTime;
+    std::chrono::steady_clock::duration m_nestedTime {};
+
+    LayoutProfilingScope(const LayoutProfilingScope &) = delete;
+    LayoutProfilingScope &operator=(const LayoutProfilingScope &) = delete;
+};
+
+inline void LayoutingHost::recordItemVisited()
+{
+    if (m_profilingScope)
+        m_profilingScope->m_stats->itemsVisited++;
+}
+
+inline void LayoutingHost::recordGuestGeometryUpdate()
+{
+    if (m_profilingScope)
+        m_profilingScope->m_stats->guestGeometryUpdates++;
+}
+
+inline void LayoutingHost::recordSignalEmission()
+{
+    if (m_profilingScope)
+        m_profilingScope->m_stats->signalEmissions++;
+}
+
 }
 
 }
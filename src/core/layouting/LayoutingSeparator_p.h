@@ -35,6 +35,10 @@ public:
     virtual void raise();
     virtual void free();
 
+    /// Called when the separator is put into its host's pool (@p pooled is true) or taken out of it.
+    /// While pooled it must not be visible.
+    virtual void setPooled(bool pooled);
+
     int position() const;
     bool isVertical() const;
     ItemBoxContainer *parentContainer() const;
@@ -49,7 +53,8 @@ public:
 
     LayoutingHost *const m_host;
     const Qt::Orientation m_orientation;
-    Core::ItemBoxContainer *const m_parentContainer;
+    /// Not const, as pooled separators are reused by other containers of the same host
+    Core::ItemBoxContainer *m_parentContainer;
 
     static LayoutingSeparator *s_separatorBeingDragged;
 
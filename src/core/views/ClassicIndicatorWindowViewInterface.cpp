@@ -16,3 +16,13 @@ using namespace KDDockWidgets::Core;
 ClassicIndicatorWindowViewInterface::~ClassicIndicatorWindowViewInterface()
 {
 }
+
+KDDockWidgets::DropLocation ClassicIndicatorWindowViewInterface::dropLocationAt(Point) const
+{
+    return DropLocation_None;
+}
+
+bool ClassicIndicatorWindowViewInterface::setClassicIndicators(ClassicDropIndicatorOverlay *)
+{
+    return false;
+}
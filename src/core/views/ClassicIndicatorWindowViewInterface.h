@@ -19,6 +19,8 @@ QT_END_NAMESPACE
 
 namespace KDDockWidgets::Core {
 
+class ClassicDropIndicatorOverlay;
+
 /// @brief The window that will hold the classic indicators
 /// This is a window so it can be over the window that is being dragged
 class DOCKS_EXPORT ClassicIndicatorWindowViewInterface
@@ -35,6 +37,10 @@ public:
     ///   the "active" icon variant.
     virtual DropLocation hover(Point) = 0;
 
+    /// Returns the visible indicator under the specified global position, without changing
+    /// any hover state. The default implementation returns DropLocation_None, meaning unknown.
+    virtual DropLocation dropLocationAt(Point globalPos) const;
+
     /// Returns the position for the specified drop indicator
     /// This is used by tests only, so we know where to drop a window
     /// The position is the center of the indicator and is in global coordinates
@@ -54,6 +60,12 @@ public:
     virtual bool isWindow() const = 0;
     virtual void updateIndicatorVisibility() = 0;
 
+    /// Makes this window show the indicators of another overlay.
+    /// Used when Config::sharedClassicIndicatorWindow() is enabled.
+    /// Returns false if the window can't be shared, for example if it's not a top-level, in which
+    /// case each drop area keeps its own window. The default implementation returns false.
+    virtual bool setClassicIndicators(ClassicDropIndicatorOverlay *);
+
     ClassicIndicatorWindowViewInterface(const ClassicIndicatorWindowViewInterface &) = delete;
     ClassicIndicatorWindowViewInterface &operator=(const ClassicIndicatorWindowViewInterface &) = delete;
 };
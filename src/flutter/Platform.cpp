@@ -21,8 +21,10 @@
 #include "core/ViewGuard.h"
 #include "ViewFactory.h"
 #include "kddockwidgets/core/MainWindow.h"
+#include "kddockwidgets/core/DockRegistry.h"
 
 #include <mutex>
+#include <vector>
 #include <memory.h>
 
 using namespace KDDockWidgets;
@@ -84,9 +86,23 @@ Core::ViewFactory *Platform::createDefaultViewFactory()
     return new ViewFactory();
 }
 
-Core::Window::Ptr Platform::windowAt(Point) const
+Core::Window::Ptr Platform::windowAt(Point globalPos) const
 {
-    KDDW_WARN("Platform::windowAt: Not implemented");
+    // Flutter has no window manager to ask, so use the z-order tracked by DockRegistry.
+    // Floating windows are above main windows, check them front to back first.
+    const auto floatingWindows = DockRegistry::self()->floatingQWindows();
+    for (auto i = floatingWindows.size() - 1; i >= 0; --i) {
+        const Core::Window::Ptr &window = floatingWindows.at(i);
+        if (window->rootView()->isVisible() && window->geometry().contains(globalPos))
+            return window;
+    }
+
+    const auto mainWindows = DockRegistry::self()->topLevels(/*excludeFloatingDocks=*/true);
+    for (const Core::Window::Ptr &window : mainWindows) {
+        if (window->geometry().contains(globalPos))
+            return window;
+    }
+
     return {};
 }
 
@@ -210,6 +226,33 @@ void Platform::rebuildWindowOverlay()
     KDDW_WARN("Platform::rebuildWindowOverlay: Implemented in dart");
 }
 
+void Platform::scheduleBatchedUpdatesFlush()
+{
+    // Dart flushes at the next frame instead. Without it there's no frame to wait for, so deliver
+    // the updates right away, as if they weren't batched.
+    const int count = flutter::View::batchedUpdatesCount();
+    const auto buffer = static_cast<const int64_t *>(flutter::View::batchedUpdatesBuffer());
+
+    std::vector<std::pair<Core::ViewGuard, int64_t>> updates;
+    updates.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const int64_t *record = buffer + i * flutter::View::BatchedUpdateRecordSize;
+        updates.push_back({ reinterpret_cast<flutter::View *>(intptr_t(record[0])), record[5] });
+    }
+
+    // Clear before delivering, so updates caused by it start a new batch
+    flutter::View::clearBatchedUpdates();
+
+    for (auto &update : updates) {
+        if (update.first && (update.second & flutter::View::BatchedUpdate_Geometry))
+            static_cast<flutter::View *>(update.first.view())->onGeometryChanged();
+
+        // The child isn't recorded, so rebuild the whole view
+        if (update.first && (update.second & flutter::View::BatchedUpdate_Children))
+            static_cast<flutter::View *>(update.first.view())->onRebuildRequested();
+    }
+}
+
 void Platform::runDelayed(int, Core::DelayedCall *)
 {
     Q_UNREACHABLE(); // Platform.dart gets called instead
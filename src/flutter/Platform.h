@@ -69,6 +69,12 @@ public:
     virtual void onDropIndicatorOverlayDestroyed(flutter::IndicatorWindow *);
     virtual void rebuildWindowOverlay();
 
+    /// Implemented in Dart. Called when flutter::View records the first update of a batch,
+    /// Dart then processes the whole batch in its next frame.
+    /// The C++ implementation delivers the pending updates right away.
+    /// @sa flutter::View::setBatchedUpdatesEnabled()
+    virtual void scheduleBatchedUpdatesFlush();
+
     void runDelayed(int ms, Core::DelayedCall *c) override;
 
 #ifdef KDDW_FLUTTER_HAS_COROUTINES
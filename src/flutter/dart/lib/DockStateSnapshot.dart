@@ -0,0 +1,94 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2023 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+import 'dart:convert';
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
+import 'package:KDDockWidgetsBindings/Bindings.dart' as KDDockWidgetBindings;
+
+/// One window, group or dock widget in a DockStateSnapshot
+class DockStateNode {
+  final int kind; // LayoutSaver::SnapshotNodeKind
+  final int parentIndex;
+  final int x;
+  final int y;
+  final int width;
+  final int height;
+  final int flags; // LayoutSaver::SnapshotNodeFlag
+  final int tabIndex;
+  final String name;
+  final String title;
+
+  DockStateNode(this.kind, this.parentIndex, this.x, this.y, this.width,
+      this.height, this.flags, this.tabIndex, this.name, this.title);
+
+  bool get isVisible => flags & 1 != 0;
+  bool get isFloating => flags & 2 != 0;
+  bool get isCurrentTab => flags & 4 != 0;
+  bool get isInSideBar => flags & 8 != 0;
+}
+
+/// The whole dock state, read with a single copy out of C++
+/// See LayoutSaver::serializeSnapshot() for the format.
+class DockStateSnapshot {
+  // Keep in sync with LayoutSaver.cpp
+  static const int _magic = 0x4B444453;
+  static const int _headerSize = 4;
+  static const int _nodeSize = 12;
+  static const int supportedVersion = 1;
+
+  final List<DockStateNode> nodes;
+
+  DockStateSnapshot._(this.nodes);
+
+  /// Takes a snapshot with [saver], which can be reused for the next frames
+  static DockStateSnapshot? take(KDDockWidgetBindings.LayoutSaver saver) {
+    final int size = saver.updateSnapshot();
+    if (size < _headerSize * 4) return null;
+
+    final ffi.Pointer<ffi.Uint8> buffer =
+        saver.snapshotBuffer().cast<ffi.Uint8>();
+    return fromBytes(Uint8List.fromList(buffer.asTypedList(size)));
+  }
+
+  static DockStateSnapshot? fromBytes(Uint8List bytes) {
+    final data = ByteData.sublistView(bytes);
+    final endian = Endian.host;
+    if (data.getInt32(0, endian) != _magic ||
+        data.getInt32(4, endian) != supportedVersion) return null;
+
+    final int numNodes = data.getInt32(8, endian);
+    final int stringsStart = (_headerSize + numNodes * _nodeSize) * 4;
+
+    String readString(int offset, int size) => utf8.decode(
+        bytes.sublist(stringsStart + offset, stringsStart + offset + size));
+
+    final nodes = <DockStateNode>[];
+    for (int i = 0; i < numNodes; ++i) {
+      final int base = (_headerSize + i * _nodeSize) * 4;
+      int field(int index) => data.getInt32(base + index * 4, endian);
+
+      nodes.add(DockStateNode(
+          field(0),
+          field(1),
+          field(2),
+          field(3),
+          field(4),
+          field(5),
+          field(6),
+          field(7),
+          readString(field(8), field(9)),
+          readString(field(10), field(11))));
+    }
+
+    return DockStateSnapshot._(nodes);
+  }
+}
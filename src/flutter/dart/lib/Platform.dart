@@ -21,6 +21,7 @@ import 'package:KDDockWidgetsBindings/Bindings_KDDWBindingsCore.dart'
     as KDDWBindingsCore;
 import 'package:KDDockWidgetsBindings/Bindings_KDDWBindingsFlutter.dart'
     as KDDWBindingsFlutter;
+import 'package:flutter/scheduler.dart';
 import 'ViewFactory.dart';
 
 class Platform extends KDDWBindingsFlutter.Platform {
@@ -107,6 +108,16 @@ class Platform extends KDDWBindingsFlutter.Platform {
     }
   }
 
+  @override
+  @pragma("vm:entry-point")
+  scheduleBatchedUpdatesFlush() {
+    // Processed once, at the start of the next frame
+    SchedulerBinding.instance.scheduleFrameCallback((_) {
+      View.flushBatchedUpdates();
+    });
+    SchedulerBinding.instance.scheduleFrame();
+  }
+
   @override
   @pragma("vm:entry-point")
   onFloatingWindowCreated(KDDWBindingsCore.FloatingWindow? fw) {
@@ -106,6 +106,16 @@ class PositionedWidgetState extends State<PositionedWidget>
     final container = buildContents(ctx);
     if (_fillsParent) return container;
 
+    final batched = kddwView.batchedGeometry;
+    if (batched != null) {
+      return Positioned(
+          width: batched[2] * 1.0,
+          height: batched[3] * 1.0,
+          top: batched[1] * 1.0,
+          left: batched[0] * 1.0,
+          child: container);
+    }
+
     // FLUTTER_TODO: Pass whole struct in one go, minimize ffi calls
     final geo = kddwView.viewGeometry();
 
@@ -9,6 +9,8 @@
   Contact KDAB at <info@kdab.com> for commercial licensing options.
 */
 
+import 'dart:ffi' as ffi;
+import 'dart:typed_data';
 import 'package:KDDockWidgetsBindings/Bindings.dart';
 import 'package:KDDockWidgetsBindings/Bindings_KDDWBindingsCore.dart'
     as KDDWBindingsCore;
@@ -30,4 +32,44 @@ class View extends KDDWBindingsFlutter.View with View_mixin {
       : super.fromCppPointer(cppPointer, needsAutoDelete) {
     initMixin(this, parent: null);
   }
+
+  // Keep in sync with flutter::View::BatchedUpdateFlag and BatchedUpdateRecordSize
+  static const int _batchedUpdateGeometry = 1;
+  static const int _batchedUpdateChildren = 2;
+  static const int _batchedUpdateRecordSize = 6;
+
+  /// Processes the geometry and visibility changes C++ recorded since the last frame.
+  /// The whole buffer is copied at once, instead of crossing FFI for each changed view.
+  /// Only the affected PositionedWidgets are rebuilt.
+  static void flushBatchedUpdates() {
+    final int count = KDDWBindingsFlutter.View.batchedUpdatesCount();
+    if (count == 0) return;
+
+    final ffi.Pointer<ffi.Int64> buffer =
+        KDDWBindingsFlutter.View.batchedUpdatesBuffer().cast<ffi.Int64>();
+    final records = Int64List.fromList(
+        buffer.asTypedList(count * _batchedUpdateRecordSize));
+
+    // Clear before processing, so updates caused by it start a new batch
+    KDDWBindingsFlutter.View.clearBatchedUpdates();
+
+    for (int i = 0; i < count; ++i) {
+      final int offset = i * _batchedUpdateRecordSize;
+      final int address = records[offset];
+      if (address == 0) continue; // View was deleted meanwhile
+
+      final view = KDDWBindingsCore.View.s_dartInstanceByCppPtr[address];
+      if (view is! View_mixin) continue;
+
+      final int flags = records[offset + 5];
+      if (flags & _batchedUpdateGeometry != 0) {
+        view.onBatchedGeometryChanged(records[offset + 1], records[offset + 2],
+            records[offset + 3], records[offset + 4]);
+      }
+
+      if (flags & _batchedUpdateChildren != 0) {
+        view.widgetKey.currentState?.childrenChanged();
+      }
+    }
+  }
 }
@@ -40,6 +40,10 @@ mixin View_mixin {
 
   var childWidgets = <Widget>[];
 
+  /// x, y, width and height received through the last batched update.
+  /// Saves calling into C++ for the geometry when building.
+  List<int>? batchedGeometry;
+
   void initMixin(var kddwView,
       {required KDDWBindingsCore.View? parent,
       var color = Colors.transparent,
@@ -100,6 +104,9 @@ mixin View_mixin {
 
   @pragma("vm:entry-point")
   void onGeometryChanged() {
+    // Not batched, so whatever we cached is stale
+    batchedGeometry = null;
+
     try {
       final state = widgetKey.currentState;
       if (state != null) {
@@ -119,6 +126,20 @@ mixin View_mixin {
     }
   }
 
+  /// Called by View.flushBatchedUpdates() instead of onGeometryChanged()
+  void onBatchedGeometryChanged(int x, int y, int width, int height) {
+    batchedGeometry = [x, y, width, height];
+
+    widgetKey.currentState?.updateSize();
+
+    if (windowWidget != null) {
+      final windowState = (windowWidget!.key as GlobalStringKey).currentState;
+      if (windowState != null) {
+        (windowState as WindowWidgetState).onGeometryChanged();
+      }
+    }
+  }
+
   static View_mixin fromCpp(KDDWBindingsCore.View? viewCpp) {
     return KDDWBindingsFlutter.View.fromCache(viewCpp!.thisCpp) as View_mixin;
   }
@@ -349,6 +349,19 @@ void Platform_wrapper::runTests()
 {
     ::KDDockWidgets::flutter::Platform::runTests();
 }
+void Platform_wrapper::scheduleBatchedUpdatesFlush()
+{
+    if (m_scheduleBatchedUpdatesFlushCallback) {
+        const void *thisPtr = this;
+        m_scheduleBatchedUpdatesFlushCallback(const_cast<void *>(thisPtr));
+    } else {
+        ::KDDockWidgets::flutter::Platform::scheduleBatchedUpdatesFlush();
+    }
+}
+void Platform_wrapper::scheduleBatchedUpdatesFlush_nocallback()
+{
+    ::KDDockWidgets::flutter::Platform::scheduleBatchedUpdatesFlush();
+}
 void Platform_wrapper::scheduleResumeCoRoutines(int ms) const
 {
     if (m_scheduleResumeCoRoutinesCallback) {
@@ -744,6 +757,11 @@ void c_KDDockWidgets__flutter__Platform__runTests(void *thisObj)
 {
     fromPtr(thisObj)->runTests();
 }
+// scheduleBatchedUpdatesFlush()
+void c_KDDockWidgets__flutter__Platform__scheduleBatchedUpdatesFlush(void *thisObj)
+{
+    [&] {auto targetPtr = fromPtr(thisObj);auto wrapperPtr = dynamic_cast<KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::Platform_wrapper*>(targetPtr);if (wrapperPtr) {    return wrapperPtr->scheduleBatchedUpdatesFlush_nocallback();} else {    return targetPtr->scheduleBatchedUpdatesFlush();} }();
+}
 // scheduleResumeCoRoutines(int ms) const
 void c_KDDockWidgets__flutter__Platform__scheduleResumeCoRoutines_int(void *thisObj, int ms)
 {
@@ -922,6 +940,9 @@ void c_KDDockWidgets__flutter__Platform__registerVirtualMethodCallback(void *ptr
     case 157:
         wrapper->m_runDelayedCallback = reinterpret_cast<KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::Platform_wrapper::Callback_runDelayed>(callback);
         break;
+    case 190:
+        wrapper->m_scheduleBatchedUpdatesFlushCallback = reinterpret_cast<KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::Platform_wrapper::Callback_scheduleBatchedUpdatesFlush>(callback);
+        break;
     case 189:
         wrapper->m_scheduleResumeCoRoutinesCallback = reinterpret_cast<KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::Platform_wrapper::Callback_scheduleResumeCoRoutines>(callback);
         break;
@@ -80,6 +80,8 @@ public:
     virtual void runDelayed(int ms, KDDockWidgets::Core::DelayedCall *c);
     virtual void runDelayed_nocallback(int ms, KDDockWidgets::Core::DelayedCall *c);
     void runTests();
+    virtual void scheduleBatchedUpdatesFlush();
+    virtual void scheduleBatchedUpdatesFlush_nocallback();
     virtual void scheduleResumeCoRoutines(int ms) const;
     virtual void scheduleResumeCoRoutines_nocallback(int ms) const;
     virtual int screenNumberForView(KDDockWidgets::Core::View *arg__1) const;
@@ -158,6 +160,8 @@ public:
     Callback_restoreMouseCursor m_restoreMouseCursorCallback = nullptr;
     typedef void (*Callback_runDelayed)(void *, int ms, KDDockWidgets::Core::DelayedCall *c);
     Callback_runDelayed m_runDelayedCallback = nullptr;
+    typedef void (*Callback_scheduleBatchedUpdatesFlush)(void *);
+    Callback_scheduleBatchedUpdatesFlush m_scheduleBatchedUpdatesFlushCallback = nullptr;
     typedef void (*Callback_scheduleResumeCoRoutines)(void *, int ms);
     Callback_scheduleResumeCoRoutines m_scheduleResumeCoRoutinesCallback = nullptr;
     typedef int (*Callback_screenNumberForView)(void *, KDDockWidgets::Core::View *arg__1);
@@ -250,6 +254,8 @@ DOCKS_EXPORT void c_KDDockWidgets__flutter__Platform__resumeCoRoutines(void *thi
 DOCKS_EXPORT void c_KDDockWidgets__flutter__Platform__runDelayed_int_DelayedCall(void *thisObj, int ms, void *c_);
 // KDDockWidgets::flutter::Platform::runTests()
 DOCKS_EXPORT void c_KDDockWidgets__flutter__Platform__runTests(void *thisObj);
+// KDDockWidgets::flutter::Platform::scheduleBatchedUpdatesFlush()
+DOCKS_EXPORT void c_KDDockWidgets__flutter__Platform__scheduleBatchedUpdatesFlush(void *thisObj);
 // KDDockWidgets::flutter::Platform::scheduleResumeCoRoutines(int ms) const
 DOCKS_EXPORT void c_KDDockWidgets__flutter__Platform__scheduleResumeCoRoutines_int(void *thisObj, int ms);
 // KDDockWidgets::flutter::Platform::screenNumberForView(KDDockWidgets::Core::View * arg__1) const
@@ -47,6 +47,22 @@ void View_wrapper::activateWindow_nocallback()
 {
     ::KDDockWidgets::flutter::View::activateWindow();
 }
+void *View_wrapper::batchedUpdatesBuffer()
+{
+    return ::KDDockWidgets::flutter::View::batchedUpdatesBuffer();
+}
+int View_wrapper::batchedUpdatesCount()
+{
+    return ::KDDockWidgets::flutter::View::batchedUpdatesCount();
+}
+bool View_wrapper::batchedUpdatesEnabled()
+{
+    return ::KDDockWidgets::flutter::View::batchedUpdatesEnabled();
+}
+void View_wrapper::clearBatchedUpdates()
+{
+    ::KDDockWidgets::flutter::View::clearBatchedUpdates();
+}
 bool View_wrapper::close()
 {
     if (m_closeCallback) {
@@ -510,6 +526,10 @@ void View_wrapper::releaseMouse_nocallback()
 {
     ::KDDockWidgets::flutter::View::releaseMouse();
 }
+void View_wrapper::setBatchedUpdatesEnabled(bool arg__1)
+{
+    ::KDDockWidgets::flutter::View::setBatchedUpdatesEnabled(arg__1);
+}
 void View_wrapper::setCursor(Qt::CursorShape shape)
 {
     if (m_setCursorCallback) {
@@ -848,6 +868,29 @@ void c_KDDockWidgets__flutter__View__activateWindow(void *thisObj)
 {
     [&] {auto targetPtr = fromPtr(thisObj);auto wrapperPtr = dynamic_cast<KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::View_wrapper*>(targetPtr);if (wrapperPtr) {    return wrapperPtr->activateWindow_nocallback();} else {    return targetPtr->activateWindow();} }();
 }
+// batchedUpdatesBuffer()
+void *c_static_KDDockWidgets__flutter__View__batchedUpdatesBuffer()
+{
+    const auto &result = KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::View_wrapper::batchedUpdatesBuffer();
+    return result;
+}
+// batchedUpdatesCount()
+int c_static_KDDockWidgets__flutter__View__batchedUpdatesCount()
+{
+    const auto &result = KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::View_wrapper::batchedUpdatesCount();
+    return result;
+}
+// batchedUpdatesEnabled()
+bool c_static_KDDockWidgets__flutter__View__batchedUpdatesEnabled()
+{
+    const auto &result = KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::View_wrapper::batchedUpdatesEnabled();
+    return result;
+}
+// clearBatchedUpdates()
+void c_static_KDDockWidgets__flutter__View__clearBatchedUpdates()
+{
+    KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::View_wrapper::clearBatchedUpdates();
+}
 // close()
 bool c_KDDockWidgets__flutter__View__close(void *thisObj)
 {
@@ -1069,6 +1112,11 @@ void c_KDDockWidgets__flutter__View__releaseMouse(void *thisObj)
 {
     [&] {auto targetPtr = fromPtr(thisObj);auto wrapperPtr = dynamic_cast<KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::View_wrapper*>(targetPtr);if (wrapperPtr) {    return wrapperPtr->releaseMouse_nocallback();} else {    return targetPtr->releaseMouse();} }();
 }
+// setBatchedUpdatesEnabled(bool arg__1)
+void c_static_KDDockWidgets__flutter__View__setBatchedUpdatesEnabled_bool(bool arg__1)
+{
+    KDDockWidgetsBindings_wrappersNS::KDDWBindingsFlutter::View_wrapper::setBatchedUpdatesEnabled(arg__1);
+}
 // setCursor(Qt::CursorShape shape)
 void c_KDDockWidgets__flutter__View__setCursor_CursorShape(void *thisObj, int shape)
 {
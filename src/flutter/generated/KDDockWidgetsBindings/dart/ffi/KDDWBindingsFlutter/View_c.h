@@ -34,6 +34,10 @@ public:
     View_wrapper(KDDockWidgets::Core::Controller *controller, KDDockWidgets::Core::ViewType type, KDDockWidgets::Core::View *arg__3, Qt::WindowFlags windowFlags = {});
     virtual void activateWindow();
     virtual void activateWindow_nocallback();
+    static void *batchedUpdatesBuffer();
+    static int batchedUpdatesCount();
+    static bool batchedUpdatesEnabled();
+    static void clearBatchedUpdates();
     virtual bool close();
     virtual bool close_nocallback();
     virtual void createPlatformWindow();
@@ -106,6 +110,7 @@ public:
     virtual void releaseKeyboard_nocallback();
     virtual void releaseMouse();
     virtual void releaseMouse_nocallback();
+    static void setBatchedUpdatesEnabled(bool arg__1);
     virtual void setCursor(Qt::CursorShape shape);
     virtual void setCursor_nocallback(Qt::CursorShape shape);
     virtual void setFixedHeight(int h);
@@ -280,6 +285,14 @@ extern "C" {
 DOCKS_EXPORT void *c_KDDockWidgets__flutter__View__constructor_Controller_ViewType_View_WindowFlags(void *controller_, int type, void *arg__3_, int windowFlags);
 // KDDockWidgets::flutter::View::activateWindow()
 DOCKS_EXPORT void c_KDDockWidgets__flutter__View__activateWindow(void *thisObj);
+// KDDockWidgets::flutter::View::batchedUpdatesBuffer()
+DOCKS_EXPORT void *c_static_KDDockWidgets__flutter__View__batchedUpdatesBuffer();
+// KDDockWidgets::flutter::View::batchedUpdatesCount()
+DOCKS_EXPORT int c_static_KDDockWidgets__flutter__View__batchedUpdatesCount();
+// KDDockWidgets::flutter::View::batchedUpdatesEnabled()
+DOCKS_EXPORT bool c_static_KDDockWidgets__flutter__View__batchedUpdatesEnabled();
+// KDDockWidgets::flutter::View::clearBatchedUpdates()
+DOCKS_EXPORT void c_static_KDDockWidgets__flutter__View__clearBatchedUpdates();
 // KDDockWidgets::flutter::View::close()
 DOCKS_EXPORT bool c_KDDockWidgets__flutter__View__close(void *thisObj);
 // KDDockWidgets::flutter::View::createPlatformWindow()
@@ -354,6 +367,8 @@ DOCKS_EXPORT void c_KDDockWidgets__flutter__View__raiseWindow_View(void *thisObj
 DOCKS_EXPORT void c_KDDockWidgets__flutter__View__releaseKeyboard(void *thisObj);
 // KDDockWidgets::flutter::View::releaseMouse()
 DOCKS_EXPORT void c_KDDockWidgets__flutter__View__releaseMouse(void *thisObj);
+// KDDockWidgets::flutter::View::setBatchedUpdatesEnabled(bool arg__1)
+DOCKS_EXPORT void c_static_KDDockWidgets__flutter__View__setBatchedUpdatesEnabled_bool(bool arg__1);
 // KDDockWidgets::flutter::View::setCursor(Qt::CursorShape shape)
 DOCKS_EXPORT void c_KDDockWidgets__flutter__View__setCursor_CursorShape(void *thisObj, int shape);
 // KDDockWidgets::flutter::View::setFixedHeight(int h)
@@ -45,6 +45,18 @@ bool LayoutSaver_wrapper::saveToFile(const QString &jsonFilename)
 {
     return ::KDDockWidgets::LayoutSaver::saveToFile(jsonFilename);
 }
+void *LayoutSaver_wrapper::snapshotBuffer()
+{
+    return ::KDDockWidgets::LayoutSaver::snapshotBuffer();
+}
+int LayoutSaver_wrapper::snapshotVersion()
+{
+    return ::KDDockWidgets::LayoutSaver::snapshotVersion();
+}
+int LayoutSaver_wrapper::updateSnapshot()
+{
+    return ::KDDockWidgets::LayoutSaver::updateSnapshot();
+}
 LayoutSaver_wrapper::~LayoutSaver_wrapper()
 {
 }
@@ -90,6 +102,24 @@ bool c_KDDockWidgets__LayoutSaver__saveToFile_QString(void *thisObj, const char
     free(( char * )jsonFilename_);
     return result;
 }
+// snapshotBuffer()
+void *c_KDDockWidgets__LayoutSaver__snapshotBuffer(void *thisObj)
+{
+    const auto &result = fromPtr(thisObj)->snapshotBuffer();
+    return result;
+}
+// snapshotVersion()
+int c_static_KDDockWidgets__LayoutSaver__snapshotVersion()
+{
+    const auto &result = KDDockWidgetsBindings_wrappersNS::LayoutSaver_wrapper::snapshotVersion();
+    return result;
+}
+// updateSnapshot()
+int c_KDDockWidgets__LayoutSaver__updateSnapshot(void *thisObj)
+{
+    const auto &result = fromPtr(thisObj)->updateSnapshot();
+    return result;
+}
 void c_KDDockWidgets__LayoutSaver__destructor(void *thisObj)
 {
     delete fromPtr(thisObj);
@@ -21,6 +21,9 @@ public:
     bool restoreFromFile(const QString &jsonFilename);
     static bool restoreInProgress();
     bool saveToFile(const QString &jsonFilename);
+    void *snapshotBuffer();
+    static int snapshotVersion();
+    int updateSnapshot();
 };
 }
 extern "C" {
@@ -32,6 +35,12 @@ DOCKS_EXPORT bool c_KDDockWidgets__LayoutSaver__restoreFromFile_QString(void *th
 DOCKS_EXPORT bool c_static_KDDockWidgets__LayoutSaver__restoreInProgress();
 // KDDockWidgets::LayoutSaver::saveToFile(const QString & jsonFilename)
 DOCKS_EXPORT bool c_KDDockWidgets__LayoutSaver__saveToFile_QString(void *thisObj, const char *jsonFilename_);
+// KDDockWidgets::LayoutSaver::snapshotBuffer()
+DOCKS_EXPORT void *c_KDDockWidgets__LayoutSaver__snapshotBuffer(void *thisObj);
+// KDDockWidgets::LayoutSaver::snapshotVersion()
+DOCKS_EXPORT int c_static_KDDockWidgets__LayoutSaver__snapshotVersion();
+// KDDockWidgets::LayoutSaver::updateSnapshot()
+DOCKS_EXPORT int c_KDDockWidgets__LayoutSaver__updateSnapshot(void *thisObj);
 DOCKS_EXPORT void c_KDDockWidgets__LayoutSaver__destructor(void *thisObj);
 DOCKS_EXPORT void c_KDDockWidgets__LayoutSaver_Finalizer(void *cppObj);
 }
@@ -221,6 +221,12 @@ bool c_KDDockWidgets__LayoutSaver__restoreFromFile_QString(void *thisObj, const
 bool c_static_KDDockWidgets__LayoutSaver__restoreInProgress();
 // KDDockWidgets::LayoutSaver::saveToFile(const QString & jsonFilename)
 bool c_KDDockWidgets__LayoutSaver__saveToFile_QString(void *thisObj, const char *jsonFilename_);
+// KDDockWidgets::LayoutSaver::snapshotBuffer()
+void *c_KDDockWidgets__LayoutSaver__snapshotBuffer(void *thisObj);
+// KDDockWidgets::LayoutSaver::snapshotVersion()
+int c_static_KDDockWidgets__LayoutSaver__snapshotVersion();
+// KDDockWidgets::LayoutSaver::updateSnapshot()
+int c_KDDockWidgets__LayoutSaver__updateSnapshot(void *thisObj);
 void c_KDDockWidgets__LayoutSaver__destructor(void *thisObj);
 void c_KDDockWidgets__LayoutSaver_Finalizer(void *cppObj); // KDDockWidgets::InitialOption::InitialOption()
 void *c_KDDockWidgets__InitialOption__constructor();
@@ -395,6 +401,8 @@ void c_KDDockWidgets__flutter__Platform__resumeCoRoutines(void *thisObj);
 void c_KDDockWidgets__flutter__Platform__runDelayed_int_DelayedCall(void *thisObj, int ms, void *c_);
 // KDDockWidgets::flutter::Platform::runTests()
 void c_KDDockWidgets__flutter__Platform__runTests(void *thisObj);
+// KDDockWidgets::flutter::Platform::scheduleBatchedUpdatesFlush()
+void c_KDDockWidgets__flutter__Platform__scheduleBatchedUpdatesFlush(void *thisObj);
 // KDDockWidgets::flutter::Platform::scheduleResumeCoRoutines(int ms) const
 void c_KDDockWidgets__flutter__Platform__scheduleResumeCoRoutines_int(void *thisObj, int ms);
 // KDDockWidgets::flutter::Platform::screenNumberForView(KDDockWidgets::Core::View * arg__1) const
@@ -885,6 +893,14 @@ void c_KDDockWidgets__Core__View_Finalizer(void *cppObj); // KDDockWidgets::flut
 void *c_KDDockWidgets__flutter__View__constructor_Controller_ViewType_View_WindowFlags(void *controller_, int type, void *arg__3_, int windowFlags);
 // KDDockWidgets::flutter::View::activateWindow()
 void c_KDDockWidgets__flutter__View__activateWindow(void *thisObj);
+// KDDockWidgets::flutter::View::batchedUpdatesBuffer()
+void *c_static_KDDockWidgets__flutter__View__batchedUpdatesBuffer();
+// KDDockWidgets::flutter::View::batchedUpdatesCount()
+int c_static_KDDockWidgets__flutter__View__batchedUpdatesCount();
+// KDDockWidgets::flutter::View::batchedUpdatesEnabled()
+bool c_static_KDDockWidgets__flutter__View__batchedUpdatesEnabled();
+// KDDockWidgets::flutter::View::clearBatchedUpdates()
+void c_static_KDDockWidgets__flutter__View__clearBatchedUpdates();
 // KDDockWidgets::flutter::View::close()
 bool c_KDDockWidgets__flutter__View__close(void *thisObj);
 // KDDockWidgets::flutter::View::createPlatformWindow()
@@ -959,6 +975,8 @@ void c_KDDockWidgets__flutter__View__raiseWindow_View(void *thisObj, void *rootV
 void c_KDDockWidgets__flutter__View__releaseKeyboard(void *thisObj);
 // KDDockWidgets::flutter::View::releaseMouse()
 void c_KDDockWidgets__flutter__View__releaseMouse(void *thisObj);
+// KDDockWidgets::flutter::View::setBatchedUpdatesEnabled(bool arg__1)
+void c_static_KDDockWidgets__flutter__View__setBatchedUpdatesEnabled_bool(bool arg__1);
 // KDDockWidgets::flutter::View::setCursor(Qt::CursorShape shape)
 void c_KDDockWidgets__flutter__View__setCursor_CursorShape(void *thisObj, int shape);
 // KDDockWidgets::flutter::View::setFixedHeight(int h)
@@ -420,6 +420,26 @@ class Platform extends KDDWBindingsCore.Platform {
             'c_KDDockWidgets__flutter__Platform__runTests')
         .asFunction();
     func(thisCpp);
+  } // scheduleBatchedUpdatesFlush()
+
+  scheduleBatchedUpdatesFlush() {
+    final void_Func_voidstar func = _dylib
+        .lookup<ffi.NativeFunction<void_Func_voidstar_FFI>>(
+            cFunctionSymbolName(190))
+        .asFunction();
+    func(thisCpp);
+  }
+
+  static void scheduleBatchedUpdatesFlush_calledFromC(
+      ffi.Pointer<void> thisCpp) {
+    var dartInstance = KDDWBindingsCore
+        .Platform.s_dartInstanceByCppPtr[thisCpp.address] as Platform;
+    if (dartInstance == null) {
+      print(
+          "Dart instance not found for Platform::scheduleBatchedUpdatesFlush()! (${thisCpp.address})");
+      throw Error();
+    }
+    dartInstance.scheduleBatchedUpdatesFlush();
   } // scheduleResumeCoRoutines(int ms) const
 
   scheduleResumeCoRoutines(int ms) {
@@ -706,6 +726,8 @@ class Platform extends KDDWBindingsCore.Platform {
         return "c_KDDockWidgets__flutter__Platform__restoreMouseCursor";
       case 157:
         return "c_KDDockWidgets__flutter__Platform__runDelayed_int_DelayedCall";
+      case 190:
+        return "c_KDDockWidgets__flutter__Platform__scheduleBatchedUpdatesFlush";
       case 189:
         return "c_KDDockWidgets__flutter__Platform__scheduleResumeCoRoutines_int";
       case 158:
@@ -790,6 +812,8 @@ class Platform extends KDDWBindingsCore.Platform {
         return "restoreMouseCursor";
       case 157:
         return "runDelayed";
+      case 190:
+        return "scheduleBatchedUpdatesFlush";
       case 189:
         return "scheduleResumeCoRoutines";
       case 158:
@@ -920,6 +944,9 @@ class Platform extends KDDWBindingsCore.Platform {
         ffi.Pointer.fromFunction<void_Func_voidstar_ffi_Int32_voidstar_FFI>(
             KDDWBindingsFlutter.Platform.runDelayed_calledFromC);
     registerCallback(thisCpp, callback157, 157);
+    final callback190 = ffi.Pointer.fromFunction<void_Func_voidstar_FFI>(
+        KDDWBindingsFlutter.Platform.scheduleBatchedUpdatesFlush_calledFromC);
+    registerCallback(thisCpp, callback190, 190);
     final callback189 =
         ffi.Pointer.fromFunction<void_Func_voidstar_ffi_Int32_FFI>(
             KDDWBindingsFlutter.Platform.scheduleResumeCoRoutines_calledFromC);
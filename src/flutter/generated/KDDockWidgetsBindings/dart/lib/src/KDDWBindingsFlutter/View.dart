@@ -60,6 +60,43 @@ class View extends KDDWBindingsCore.View {
     dartInstance.activateWindow();
   }
 
+  static // batchedUpdatesBuffer()
+      ffi.Pointer<void> batchedUpdatesBuffer() {
+    final voidstar_Func_void func = _dylib
+        .lookup<ffi.NativeFunction<voidstar_Func_void_FFI>>(
+            'c_static_KDDockWidgets__flutter__View__batchedUpdatesBuffer')
+        .asFunction();
+    ffi.Pointer<void> result = func();
+    return result;
+  }
+
+  static // batchedUpdatesCount()
+      int batchedUpdatesCount() {
+    final int_Func_void func = _dylib
+        .lookup<ffi.NativeFunction<int_Func_void_FFI>>(
+            'c_static_KDDockWidgets__flutter__View__batchedUpdatesCount')
+        .asFunction();
+    return func();
+  }
+
+  static // batchedUpdatesEnabled()
+      bool batchedUpdatesEnabled() {
+    final bool_Func_void func = _dylib
+        .lookup<ffi.NativeFunction<bool_Func_void_FFI>>(
+            'c_static_KDDockWidgets__flutter__View__batchedUpdatesEnabled')
+        .asFunction();
+    return func() != 0;
+  }
+
+  static // clearBatchedUpdates()
+      void clearBatchedUpdates() {
+    final void_Func_void func = _dylib
+        .lookup<ffi.NativeFunction<void_Func_void_FFI>>(
+            'c_static_KDDockWidgets__flutter__View__clearBatchedUpdates')
+        .asFunction();
+    func();
+  }
+
   static int close_calledFromC(ffi.Pointer<void> thisCpp) {
     var dartInstance =
         KDDWBindingsCore.View.s_dartInstanceByCppPtr[thisCpp.address] as View;
@@ -572,6 +609,15 @@ class View extends KDDWBindingsCore.View {
     dartInstance.releaseMouse();
   }
 
+  static // setBatchedUpdatesEnabled(bool arg__1)
+      void setBatchedUpdatesEnabled(bool arg__1) {
+    final void_Func_bool func = _dylib
+        .lookup<ffi.NativeFunction<void_Func_ffi_Int8_FFI>>(
+            'c_static_KDDockWidgets__flutter__View__setBatchedUpdatesEnabled_bool')
+        .asFunction();
+    func(arg__1 ? 1 : 0);
+  }
+
   static void setCursor_calledFromC(ffi.Pointer<void> thisCpp, int shape) {
     var dartInstance =
         KDDWBindingsCore.View.s_dartInstanceByCppPtr[thisCpp.address] as View;
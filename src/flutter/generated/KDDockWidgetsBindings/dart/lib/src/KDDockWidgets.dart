@@ -60,6 +60,7 @@ class KDDockWidgets_FrontendType {
   static const QtWidgets = 1;
   static const QtQuick = 2;
   static const Flutter = 3;
+  static const Headless = 4;
 }
 
 class KDDockWidgets_DefaultSizeMode {
@@ -89,6 +89,32 @@ class LayoutSaver implements ffi.Finalizable {
             'c_KDDockWidgets__LayoutSaver__saveToFile_QString')
         .asFunction();
     return func(thisCpp, jsonFilename?.toNativeUtf8() ?? ffi.nullptr) != 0;
+  } // snapshotBuffer()
+
+  ffi.Pointer<void> snapshotBuffer() {
+    final voidstar_Func_voidstar func = _dylib
+        .lookup<ffi.NativeFunction<voidstar_Func_voidstar_FFI>>(
+            'c_KDDockWidgets__LayoutSaver__snapshotBuffer')
+        .asFunction();
+    ffi.Pointer<void> result = func(thisCpp);
+    return result;
+  }
+
+  static // snapshotVersion()
+      int snapshotVersion() {
+    final int_Func_void func = _dylib
+        .lookup<ffi.NativeFunction<int_Func_void_FFI>>(
+            'c_static_KDDockWidgets__LayoutSaver__snapshotVersion')
+        .asFunction();
+    return func();
+  } // updateSnapshot()
+
+  int updateSnapshot() {
+    final int_Func_voidstar func = _dylib
+        .lookup<ffi.NativeFunction<int_Func_voidstar_FFI>>(
+            'c_KDDockWidgets__LayoutSaver__updateSnapshot')
+        .asFunction();
+    return func(thisCpp);
   }
 
   void release() {
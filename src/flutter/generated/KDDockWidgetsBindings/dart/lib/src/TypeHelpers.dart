@@ -228,3 +228,5 @@ typedef bool_Func_voidstar_ffi_Int32_ffi_Int32_voidstar_ffi_Int32_FFI
         ffi.Pointer<void>, ffi.Int32, ffi.Int32, ffi.Pointer<void>, ffi.Int32);
 typedef double_Func_voidstar = double Function(ffi.Pointer<void>);
 typedef double_Func_voidstar_FFI = ffi.Double Function(ffi.Pointer<void>);
+typedef void_Func_void = void Function();
+typedef void_Func_void_FFI = ffi.Void Function();
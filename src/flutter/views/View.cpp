@@ -14,14 +14,25 @@
 #include "core/Logging_p.h"
 #include "core/View_p.h"
 #include "core/layouting/Item_p.h"
+#include "kddockwidgets/core/DockRegistry.h"
+#include "kddockwidgets/core/DockWidget.h"
 #include "../Window_p.h"
 #include "ViewWrapper_p.h"
 
+#include <cstdint>
 #include <utility>
+#include <vector>
 
 using namespace KDDockWidgets;
 using namespace KDDockWidgets::flutter;
 
+namespace {
+bool s_batchedUpdatesEnabled = false;
+
+/// Flat list of BatchedUpdateRecordSize sized records, read by Dart in one go
+std::vector<int64_t> s_batchedUpdates;
+}
+
 View::View(Core::Controller *controller, Core::ViewType type, Core::View *parent,
            Qt::WindowFlags)
     : Core::View(controller, type)
@@ -37,6 +48,11 @@ View::View(Core::Controller *controller, Core::ViewType type, Core::View *parent
 View::~View()
 {
     m_inDtor = true;
+
+    // Dart might read the buffer before our record is cleared
+    if (m_batchedUpdateIndex != -1)
+        s_batchedUpdates[m_batchedUpdateIndex * BatchedUpdateRecordSize] = 0;
+
     if (hasFocus())
         Platform::platformFlutter()->setFocusedView({});
 
@@ -49,7 +65,7 @@ void View::setGeometry(Rect geo)
 {
     if (geo != m_geometry) {
         m_geometry = geo;
-        onGeometryChanged();
+        notifyGeometryChanged();
     }
 }
 
@@ -57,7 +73,7 @@ void View::move(int x, int y)
 {
     if (m_geometry.topLeft() != Point(x, y)) {
         m_geometry.moveTopLeft(Point(x, y));
-        onGeometryChanged();
+        notifyGeometryChanged();
     }
 }
 
@@ -91,6 +107,11 @@ void View::setVisible(bool is)
     if (!m_visible.has_value() || is != m_visible.value()) {
         m_visible = is;
 
+        if (is) {
+            if (auto dw = asDockWidgetController())
+                dw->createPendingGuestView();
+        }
+
         if (m_visible) {
             // Mimic QWidgets: Set children visible, unless they were explicitly hidden
             for (auto child : std::as_const(m_childViews)) {
@@ -101,7 +122,7 @@ void View::setVisible(bool is)
         }
 
         if (m_parentView) {
-            m_parentView->onChildVisibilityChanged(this);
+            m_parentView->notifyChildVisibilityChanged(this);
         }
     }
 }
@@ -114,7 +135,7 @@ bool View::isExplicitlyHidden() const
 void View::setSize(int w, int h)
 {
     m_geometry.setSize(Size(w, h));
-    onGeometryChanged();
+    notifyGeometryChanged();
 }
 
 std::shared_ptr<Core::View> View::rootView() const
@@ -180,7 +201,7 @@ void View::setWidth(int w)
 {
     if (m_geometry.width() != w) {
         m_geometry.setWidth(w);
-        onGeometryChanged();
+        notifyGeometryChanged();
     }
 }
 
@@ -188,7 +209,7 @@ void View::setHeight(int h)
 {
     if (m_geometry.height() != h) {
         m_geometry.setHeight(h);
-        onGeometryChanged();
+        notifyGeometryChanged();
     }
 }
 
@@ -277,6 +298,8 @@ void View::raise()
 {
     if (isRootView()) {
         raiseWindow(this);
+        if (auto fw = asFloatingWindowController())
+            DockRegistry::self()->onFloatingWindowRaised(fw);
     } else {
         m_parentView->raiseChild(this);
     }
@@ -509,6 +532,77 @@ void View::onGeometryChanged()
     KDDW_ERROR("Derived class should be called instead");
 }
 
+void View::notifyGeometryChanged()
+{
+    if (s_batchedUpdatesEnabled) {
+        recordBatchedUpdate(BatchedUpdate_Geometry);
+    } else {
+        onGeometryChanged();
+    }
+}
+
+void View::notifyChildVisibilityChanged(View *child)
+{
+    if (s_batchedUpdatesEnabled) {
+        recordBatchedUpdate(BatchedUpdate_Children);
+    } else {
+        onChildVisibilityChanged(child);
+    }
+}
+
+void View::recordBatchedUpdate(int flags)
+{
+    const bool wasEmpty = s_batchedUpdates.empty();
+    if (m_batchedUpdateIndex == -1) {
+        m_batchedUpdateIndex = int(s_batchedUpdates.size() / BatchedUpdateRecordSize);
+        s_batchedUpdates.insert(s_batchedUpdates.end(), BatchedUpdateRecordSize, 0);
+        s_batchedUpdates[m_batchedUpdateIndex * BatchedUpdateRecordSize] = int64_t(reinterpret_cast<intptr_t>(this));
+    }
+
+    int64_t *record = &s_batchedUpdates[m_batchedUpdateIndex * BatchedUpdateRecordSize];
+    record[1] = m_geometry.x();
+    record[2] = m_geometry.y();
+    record[3] = m_geometry.width();
+    record[4] = m_geometry.height();
+    record[5] |= flags;
+
+    // Only the first update of a batch crosses into Dart. Scheduled after the record is complete,
+    // as the C++ fallback flushes right away.
+    if (wasEmpty)
+        Platform::platformFlutter()->scheduleBatchedUpdatesFlush();
+}
+
+void View::setBatchedUpdatesEnabled(bool enabled)
+{
+    s_batchedUpdatesEnabled = enabled;
+}
+
+bool View::batchedUpdatesEnabled()
+{
+    return s_batchedUpdatesEnabled;
+}
+
+void *View::batchedUpdatesBuffer()
+{
+    return s_batchedUpdates.data();
+}
+
+int View::batchedUpdatesCount()
+{
+    return int(s_batchedUpdates.size() / BatchedUpdateRecordSize);
+}
+
+void View::clearBatchedUpdates()
+{
+    const int count = batchedUpdatesCount();
+    for (int i = 0; i < count; ++i) {
+        if (auto view = reinterpret_cast<View *>(intptr_t(s_batchedUpdates[i * BatchedUpdateRecordSize])))
+            view->m_batchedUpdateIndex = -1;
+    }
+
+    s_batchedUpdates.clear();
+}
+
 void View::raiseChild(Core::View *)
 {
     dumpDebug();
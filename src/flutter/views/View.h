@@ -131,7 +131,40 @@ public:
     /// Implemented in Dart
     virtual void onRebuildRequested();
 
+    /// Flags of a batched update record
+    enum BatchedUpdateFlag {
+        BatchedUpdate_None = 0,
+        BatchedUpdate_Geometry = 1, ///< The view's geometry changed
+        BatchedUpdate_Children = 2 ///< A child of the view was shown or hidden
+    };
+
+    /// Size, in int64 fields, of each record in batchedUpdatesBuffer():
+    /// view pointer, x, y, width, height, flags
+    static constexpr int BatchedUpdateRecordSize = 6;
+
+    /// When enabled, geometry and child visibility changes are recorded in a flat buffer instead of
+    /// calling onGeometryChanged()/onChildVisibilityChanged() into Dart for each one.
+    /// A view gets at most one record per batch. Dart reads the whole buffer once per frame.
+    /// Default is false.
+    static void setBatchedUpdatesEnabled(bool);
+    static bool batchedUpdatesEnabled();
+
+    /// Returns the buffer of pending updates, batchedUpdatesCount() records long.
+    /// Records of views which were deleted meanwhile have a null view pointer.
+    static void *batchedUpdatesBuffer();
+    static int batchedUpdatesCount();
+
+    /// Called by Dart once it processed the buffer
+    static void clearBatchedUpdates();
+
 private:
+    void notifyGeometryChanged();
+    void notifyChildVisibilityChanged(View *child);
+    void recordBatchedUpdate(int flags);
+
+    /// Index of our record in the batched updates buffer, -1 if none
+    int m_batchedUpdateIndex = -1;
+
     View *m_parentView = nullptr;
     QString m_name;
     Size m_minSize;
@@ -0,0 +1,401 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "Platform.h"
+#include "Window_p.h"
+#include "Screen_p.h"
+#include "ViewFactory.h"
+#include "views/View.h"
+
+#include "core/Platform_p.h"
+#include "core/DelayedCall_p.h"
+#include "core/EventFilterInterface.h"
+#include "core/Logging_p.h"
+#include "core/ViewGuard.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+class headless::Platform::Private
+{
+public:
+    ~Private()
+    {
+        // Pending calls are dropped, like a real event loop that's no longer running
+        for (auto &it : m_delayedCalls)
+            delete it.second;
+    }
+
+    std::shared_ptr<Core::View> m_focusedView;
+
+    /// Views without parent, from bottom to top
+    std::vector<headless::View *> m_rootViews;
+
+    headless::View *m_mouseGrabber = nullptr;
+
+    /// The view under the cursor at press time receives the events until release, as in Qt
+    headless::View *m_implicitMouseGrabber = nullptr;
+    Point m_cursorPos;
+    bool m_leftButtonPressed = false;
+
+    /// Delayed calls sorted by due time. Calls with the same due time run in the order they were scheduled.
+    std::multimap<int64_t, Core::DelayedCall *> m_delayedCalls;
+    int64_t m_currentTime = 0;
+};
+
+Platform::Platform()
+    : d(new Private())
+{
+}
+
+Platform::~Platform()
+{
+    delete d;
+}
+
+const char *Platform::name() const
+{
+    return "headless";
+}
+
+Core::ViewFactory *Platform::createDefaultViewFactory()
+{
+    return new ViewFactory();
+}
+
+std::shared_ptr<Core::View> Platform::focusedView() const
+{
+    return d->m_focusedView;
+}
+
+void Platform::setFocusedView(std::shared_ptr<Core::View> view)
+{
+    if (view == d->m_focusedView || (view && view->equals(d->m_focusedView.get())))
+        return;
+
+    d->m_focusedView = view;
+    Core::Platform::d->focusedViewChanged.emit(view);
+}
+
+Vector<std::shared_ptr<Core::Window>> Platform::windows() const
+{
+    Vector<std::shared_ptr<Core::Window>> windows;
+    for (headless::View *view : d->m_rootViews) {
+        if (view->isVisible())
+            windows.append(view->window());
+    }
+
+    return windows;
+}
+
+Core::Window::Ptr Platform::windowAt(Point globalPos) const
+{
+    for (auto it = d->m_rootViews.crbegin(); it != d->m_rootViews.crend(); ++it) {
+        headless::View *view = *it;
+        if (view->isVisible() && !view->hasAttribute(Qt::WA_TransparentForMouseEvents)
+            && view->geometry().contains(globalPos))
+            return view->window();
+    }
+
+    return {};
+}
+
+std::shared_ptr<Core::View> Platform::viewAt(Point globalPos) const
+{
+    if (auto window = windowAt(globalPos)) {
+        auto rootView = window->rootView();
+        return rootView->childViewAt(rootView->mapFromGlobal(globalPos));
+    }
+
+    return {};
+}
+
+void Platform::sendEvent(Core::View *view, Event *ev) const
+{
+    if (view)
+        view->deliverViewEventToFilters(ev);
+}
+
+int Platform::screenNumberForView(Core::View *) const
+{
+    return 0;
+}
+
+int Platform::screenNumberForWindow(std::shared_ptr<Core::Window>) const
+{
+    return 0;
+}
+
+Size Platform::screenSizeFor(Core::View *) const
+{
+    return primaryScreen()->size();
+}
+
+Core::View *Platform::createView(Core::Controller *controller, Core::View *parent) const
+{
+    return new headless::View(controller, Core::ViewType::None, parent);
+}
+
+bool Platform::inDisallowedDragView(Point) const
+{
+    return false;
+}
+
+bool Platform::usesFallbackMouseGrabber() const
+{
+    // We have a proper grabber, see setMouseGrabber()
+    return false;
+}
+
+void Platform::ungrabMouse()
+{
+    d->m_mouseGrabber = nullptr;
+}
+
+void Platform::setMouseGrabber(headless::View *view)
+{
+    d->m_mouseGrabber = view;
+}
+
+Core::Screen::List Platform::screens() const
+{
+    return { primaryScreen() };
+}
+
+Core::Screen::Ptr Platform::primaryScreen() const
+{
+    return std::make_shared<headless::Screen>();
+}
+
+bool Platform::isProcessingAppQuitEvent() const
+{
+    return false;
+}
+
+QString Platform::applicationName() const
+{
+    return QStringLiteral("headless");
+}
+
+void Platform::setMouseCursor(Qt::CursorShape, bool)
+{
+}
+
+void Platform::restoreMouseCursor()
+{
+}
+
+Core::Platform::DisplayType Platform::displayType() const
+{
+    return DisplayType::Other;
+}
+
+bool Platform::isLeftMouseButtonPressed() const
+{
+    return d->m_leftButtonPressed;
+}
+
+Point Platform::cursorPos() const
+{
+    return d->m_cursorPos;
+}
+
+void Platform::setCursorPos(Point pos)
+{
+    d->m_cursorPos = pos;
+}
+
+void Platform::runDelayed(int ms, Core::DelayedCall *c)
+{
+    d->m_delayedCalls.insert({ d->m_currentTime + std::max(ms, 0), c });
+}
+
+int Platform::processEvents()
+{
+    int numCalls = 0;
+    while (!d->m_delayedCalls.empty()) {
+        auto it = d->m_delayedCalls.begin();
+        if (it->first > d->m_currentTime)
+            break;
+
+        Core::DelayedCall *call = it->second;
+        d->m_delayedCalls.erase(it);
+        call->call();
+        delete call;
+        ++numCalls;
+    }
+
+    return numCalls;
+}
+
+void Platform::advanceTime(int ms)
+{
+    const int64_t targetTime = d->m_currentTime + std::max(ms, 0);
+    while (!d->m_delayedCalls.empty() && d->m_delayedCalls.begin()->first <= targetTime) {
+        d->m_currentTime = d->m_delayedCalls.begin()->first;
+        processEvents();
+    }
+
+    d->m_currentTime = targetTime;
+}
+
+int64_t Platform::currentTime() const
+{
+    return d->m_currentTime;
+}
+
+int Platform::numPendingEvents() const
+{
+    return int(d->m_delayedCalls.size());
+}
+
+void Platform::mouseMove(Point globalPos)
+{
+    deliverMouseEvent(Event::MouseMove, globalPos);
+}
+
+void Platform::mousePress(Point globalPos)
+{
+    d->m_leftButtonPressed = true;
+    deliverMouseEvent(Event::MouseButtonPress, globalPos);
+}
+
+void Platform::mouseRelease(Point globalPos)
+{
+    d->m_leftButtonPressed = false;
+    deliverMouseEvent(Event::MouseButtonRelease, globalPos);
+}
+
+void Platform::mouseDoubleClick(Point globalPos)
+{
+    deliverMouseEvent(Event::MouseButtonDblClick, globalPos);
+}
+
+void Platform::deliverMouseEvent(Event::Type type, Point globalPos)
+{
+    d->m_cursorPos = globalPos;
+
+    std::shared_ptr<Core::View> target;
+    if (d->m_mouseGrabber) {
+        target = d->m_mouseGrabber->asWrapper();
+    } else if (d->m_implicitMouseGrabber) {
+        target = d->m_implicitMouseGrabber->asWrapper();
+    } else {
+        target = viewAt(globalPos);
+    }
+
+    if (type == Event::MouseButtonRelease)
+        d->m_implicitMouseGrabber = nullptr;
+    else if (type == Event::MouseButtonPress && target)
+        d->m_implicitMouseGrabber = asView_headless(target.get());
+
+    if (!target)
+        return;
+
+    Qt::MouseButtons buttons = Qt::NoButton;
+    if (d->m_leftButtonPressed || type == Event::MouseButtonRelease || type == Event::MouseButtonDblClick)
+        buttons |= Qt::LeftButton;
+
+    Core::ViewGuard guard(target.get());
+
+    {
+        // Global filters see the event first, as with a QApplication event filter.
+        // Copy, as filters might get removed while the event is being processed
+        const auto filters = Core::Platform::d->m_globalEventFilters;
+        MouseEvent me(type, target->mapFromGlobal(globalPos), globalPos, globalPos, buttons, buttons, Qt::NoModifier);
+        for (Core::EventFilterInterface *filter : filters) {
+            const auto &current = Core::Platform::d->m_globalEventFilters;
+            if (std::find(current.cbegin(), current.cend(), filter) == current.cend() || !filter->enabled())
+                continue;
+
+            if (filter->onMouseEvent(target.get(), &me))
+                return;
+
+            bool accepted = false;
+            switch (type) {
+            case Event::MouseButtonPress:
+                accepted = filter->onMouseButtonPress(target.get(), &me);
+                break;
+            case Event::MouseButtonRelease:
+                accepted = filter->onMouseButtonRelease(target.get(), &me);
+                break;
+            case Event::MouseMove:
+                accepted = filter->onMouseButtonMove(target.get(), &me);
+                break;
+            case Event::MouseButtonDblClick:
+                accepted = filter->onMouseDoubleClick(target.get(), &me);
+                break;
+            default:
+                break;
+            }
+
+            if (accepted || !guard)
+                return;
+        }
+    }
+
+    // Then the view and its parents, until someone accepts it, as with QWidget event propagation
+    headless::View *view = asView_headless(target.get());
+    while (view) {
+        Core::ViewGuard viewGuard(view);
+        auto parent = view->parentView();
+
+        MouseEvent me(type, view->mapFromGlobal(globalPos), globalPos, globalPos, buttons, buttons, Qt::NoModifier);
+        if (view->deliverViewEventToFilters(&me) || !viewGuard)
+            return;
+
+        if (view->onMouseEvent(&me))
+            return;
+
+        if (!viewGuard)
+            return;
+
+        view = asView_headless(parent.get());
+    }
+}
+
+void Platform::onRootViewAdded(headless::View *view)
+{
+    if (std::find(d->m_rootViews.cbegin(), d->m_rootViews.cend(), view) == d->m_rootViews.cend())
+        d->m_rootViews.push_back(view);
+}
+
+void Platform::onRootViewRemoved(headless::View *view)
+{
+    d->m_rootViews.erase(std::remove(d->m_rootViews.begin(), d->m_rootViews.end(), view), d->m_rootViews.end());
+}
+
+void Platform::onRootViewRaised(headless::View *view)
+{
+    auto it = std::find(d->m_rootViews.begin(), d->m_rootViews.end(), view);
+    if (it != d->m_rootViews.end()) {
+        d->m_rootViews.erase(it);
+        d->m_rootViews.push_back(view);
+    }
+}
+
+void Platform::onViewDestroyed(headless::View *view)
+{
+    onRootViewRemoved(view);
+
+    if (d->m_mouseGrabber == view)
+        d->m_mouseGrabber = nullptr;
+
+    if (d->m_implicitMouseGrabber == view)
+        d->m_implicitMouseGrabber = nullptr;
+
+    if (d->m_focusedView && d->m_focusedView->equals(view))
+        setFocusedView({});
+}
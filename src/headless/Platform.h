@@ -0,0 +1,118 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "kddockwidgets/core/Platform.h"
+
+#include <cstdint>
+
+namespace KDDockWidgets {
+
+namespace headless {
+
+class View;
+
+/// @brief A platform without a display server
+///
+/// All views live in memory. There's a single virtual screen, a synthetic mouse cursor
+/// and a deterministic event loop: Delayed calls only run when processEvents() or advanceTime()
+/// are called, in the order they are due.
+///
+/// Runs the full controller stack (DockWidget, Group, DropArea, DragController, LayoutSaver)
+/// without a GPU or X, which makes it suitable for benchmarking end-to-end docking workflows.
+class DOCKS_EXPORT Platform : public Core::Platform
+{
+public:
+    Platform();
+    ~Platform() override;
+
+    static Platform *platformHeadless()
+    {
+        return static_cast<Platform *>(Platform::instance());
+    }
+
+    const char *name() const override;
+    Core::ViewFactory *createDefaultViewFactory() override;
+    std::shared_ptr<Core::Window> windowAt(Point globalPos) const override;
+
+    int screenNumberForView(Core::View *) const override;
+    int screenNumberForWindow(std::shared_ptr<Core::Window>) const override;
+    Size screenSizeFor(Core::View *) const override;
+
+    Core::View *createView(Core::Controller *controller, Core::View *parent = nullptr) const override;
+    bool inDisallowedDragView(Point globalPos) const override;
+    bool usesFallbackMouseGrabber() const override;
+    void ungrabMouse() override;
+    Vector<std::shared_ptr<Core::Screen>> screens() const override;
+    std::shared_ptr<Core::Screen> primaryScreen() const override;
+
+    void runDelayed(int ms, Core::DelayedCall *c) override;
+
+    std::shared_ptr<Core::View> focusedView() const override;
+    Vector<std::shared_ptr<Core::Window>> windows() const override;
+    void sendEvent(Core::View *, Event *) const override;
+    bool isProcessingAppQuitEvent() const override;
+    QString applicationName() const override;
+    void setMouseCursor(Qt::CursorShape, bool discardLast = false) override;
+    void restoreMouseCursor() override;
+    DisplayType displayType() const override;
+    bool isLeftMouseButtonPressed() const override;
+    Point cursorPos() const override;
+    void setCursorPos(Point) override;
+
+    void setFocusedView(std::shared_ptr<Core::View>);
+
+    /// @brief Runs the delayed calls which are due at the current virtual time
+    /// Calls scheduled meanwhile with a 0ms delay also run. Returns how many calls ran.
+    int processEvents();
+
+    /// @brief Advances the virtual clock by @p ms, running the delayed calls in the order they are due
+    void advanceTime(int ms);
+
+    /// @brief Returns the virtual time, in ms, since the platform was created
+    int64_t currentTime() const;
+
+    /// @brief Returns the number of delayed calls which didn't run yet
+    int numPendingEvents() const;
+
+    /// @brief Moves the synthetic cursor to @p globalPos and delivers a mouse move
+    void mouseMove(Point globalPos);
+
+    /// @brief Moves the synthetic cursor to @p globalPos and presses the left button
+    void mousePress(Point globalPos);
+
+    /// @brief Moves the synthetic cursor to @p globalPos and releases the left button
+    void mouseRelease(Point globalPos);
+
+    /// @brief Delivers a double click at @p globalPos. Press and release aren't included.
+    void mouseDoubleClick(Point globalPos);
+
+    /// @brief Returns the deepest visible view under @p globalPos, respecting window z-order
+    std::shared_ptr<Core::View> viewAt(Point globalPos) const;
+
+    /// Called by headless::View
+    void setMouseGrabber(headless::View *);
+    void onViewDestroyed(headless::View *);
+    void onRootViewAdded(headless::View *);
+    void onRootViewRemoved(headless::View *);
+    void onRootViewRaised(headless::View *);
+
+    class Private;
+    Private *const d;
+
+private:
+    void deliverMouseEvent(Event::Type, Point globalPos);
+};
+
+}
+
+}
@@ -0,0 +1,123 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "ViewFactory.h"
+#include "Action.h"
+
+#include "views/ClassicIndicatorsWindow.h"
+#include "views/DockWidget.h"
+#include "views/DropArea.h"
+#include "views/FloatingWindow.h"
+#include "views/Group.h"
+#include "views/Separator.h"
+#include "views/SideBar.h"
+#include "views/Stack.h"
+#include "views/TabBar.h"
+#include "views/TitleBar.h"
+
+#include "kddockwidgets/core/FloatingWindow.h"
+#include "kddockwidgets/core/MDILayout.h"
+#include "kddockwidgets/core/indicators/SegmentedDropIndicatorOverlay.h"
+
+// clazy:excludeall=ctor-missing-parent-argument
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+ViewFactory::~ViewFactory()
+{
+}
+
+Core::View *ViewFactory::createDockWidget(const QString &uniqueName, DockWidgetOptions options,
+                                          LayoutSaverOptions layoutSaverOptions,
+                                          Qt::WindowFlags) const
+{
+    return new headless::DockWidget(uniqueName, options, layoutSaverOptions);
+}
+
+Core::View *ViewFactory::createGroup(Core::Group *controller, Core::View *parent) const
+{
+    return new headless::Group(controller, parent);
+}
+
+Core::View *ViewFactory::createTitleBar(Core::TitleBar *controller, Core::View *parent) const
+{
+    return new headless::TitleBar(controller, parent);
+}
+
+Core::View *ViewFactory::createTabBar(Core::TabBar *controller, Core::View *parent) const
+{
+    return new headless::TabBar(controller, parent);
+}
+
+Core::View *ViewFactory::createStack(Core::Stack *controller, Core::View *parent) const
+{
+    return new headless::Stack(controller, parent);
+}
+
+Core::View *ViewFactory::createSeparator(Core::Separator *controller, Core::View *parent) const
+{
+    return new headless::Separator(controller, parent);
+}
+
+Core::View *ViewFactory::createFloatingWindow(Core::FloatingWindow *controller,
+                                              Core::MainWindow *, Qt::WindowFlags windowFlags) const
+{
+    // Always a top-level, the main window is only its transient parent
+    return new headless::FloatingWindow(controller, windowFlags);
+}
+
+Core::View *ViewFactory::createRubberBand(Core::View *parent) const
+{
+    auto rubberBand = new headless::View(nullptr, Core::ViewType::RubberBand, parent);
+    rubberBand->enableAttribute(Qt::WA_TransparentForMouseEvents);
+    return rubberBand;
+}
+
+Core::View *ViewFactory::createSideBar(Core::SideBar *controller, Core::View *parent) const
+{
+    return new headless::SideBar(controller, parent);
+}
+
+KDDockWidgets::Icon ViewFactory::iconForButtonType(TitleBarButtonType, double) const
+{
+    return {};
+}
+
+Core::View *ViewFactory::createDropArea(Core::DropArea *controller, Core::View *parent) const
+{
+    return new headless::DropArea(controller, parent);
+}
+
+Core::View *ViewFactory::createMDILayout(Core::MDILayout *controller, Core::View *parent) const
+{
+    return new headless::View(controller, Core::ViewType::MDILayout, parent);
+}
+
+Core::View *
+ViewFactory::createSegmentedDropIndicatorOverlayView(Core::SegmentedDropIndicatorOverlay *controller,
+                                                     Core::View *parent) const
+{
+    auto view = new headless::View(controller, Core::ViewType::None, parent);
+    view->enableAttribute(Qt::WA_TransparentForMouseEvents);
+    return view;
+}
+
+Core::ClassicIndicatorWindowViewInterface *
+ViewFactory::createClassicIndicatorWindow(Core::ClassicDropIndicatorOverlay *controller, Core::View *parent) const
+{
+    return new headless::IndicatorWindow(controller, parent);
+}
+
+KDDockWidgets::Core::Action *ViewFactory::createAction(Core::DockWidget *dw, const char *debugName) const
+{
+    return new headless::Action(dw, debugName);
+}
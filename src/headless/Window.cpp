@@ -0,0 +1,144 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "Window_p.h"
+#include "Platform.h"
+#include "core/View.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+Window::Window(std::shared_ptr<Core::View> rootView)
+    : Core::Window()
+    , m_rootView(rootView)
+{
+}
+
+Window::~Window() = default;
+
+std::shared_ptr<Core::View> Window::rootView() const
+{
+    return m_rootView;
+}
+
+Core::Window::Ptr Window::transientParent() const
+{
+    return nullptr;
+}
+
+void Window::setGeometry(Rect r)
+{
+    m_rootView->setGeometry(r);
+}
+
+void Window::setVisible(bool is)
+{
+    m_rootView->setVisible(is);
+}
+
+bool Window::supportsHonouringLayoutMinSize() const
+{
+    return true;
+}
+
+void Window::setWindowState(WindowState)
+{
+}
+
+Rect Window::geometry() const
+{
+    return m_rootView->geometry();
+}
+
+bool Window::isVisible() const
+{
+    return m_rootView->isVisible();
+}
+
+Core::WId Window::handle() const
+{
+    return Core::WId(m_rootView ? m_rootView->handle() : Core::HANDLE());
+}
+
+bool Window::equals(std::shared_ptr<Core::Window> w) const
+{
+    return w && w->handle() == handle();
+}
+
+void Window::setFramePosition(Point pt)
+{
+    m_rootView->move(pt.x(), pt.y());
+}
+
+Rect Window::frameGeometry() const
+{
+    // No window decorations
+    return geometry();
+}
+
+void Window::resize(int w, int h)
+{
+    m_rootView->setSize(w, h);
+}
+
+bool Window::isActive() const
+{
+    return false;
+}
+
+WindowState Window::windowState() const
+{
+    return WindowState::None;
+}
+
+Point Window::mapFromGlobal(Point globalPos) const
+{
+    return m_rootView->mapFromGlobal(globalPos);
+}
+
+Point Window::mapToGlobal(Point localPos) const
+{
+    return m_rootView->mapToGlobal(localPos);
+}
+
+void Window::destroy()
+{
+}
+
+Size Window::minSize() const
+{
+    return m_rootView->minSize();
+}
+
+Size Window::maxSize() const
+{
+    return m_rootView->maxSizeHint();
+}
+
+Point Window::fromNativePixels(Point pt) const
+{
+    return pt;
+}
+
+bool Window::isFullScreen() const
+{
+    return false;
+}
+
+Core::Screen::Ptr Window::screen() const
+{
+    return Platform::instance()->primaryScreen();
+}
+
+void Window::onScreenChanged(Core::Object *, WindowScreenChangedCallback)
+{
+    // There's a single screen
+}
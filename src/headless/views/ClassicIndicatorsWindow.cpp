@@ -0,0 +1,141 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "ClassicIndicatorsWindow.h"
+#include "kddockwidgets/core/indicators/ClassicDropIndicatorOverlay.h"
+#include "kddockwidgets/core/Group.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+namespace {
+const DropLocation s_locations[] = { DropLocation_Left, DropLocation_Top, DropLocation_Right,
+                                     DropLocation_Bottom, DropLocation_Center,
+                                     DropLocation_OutterLeft, DropLocation_OutterTop,
+                                     DropLocation_OutterRight, DropLocation_OutterBottom };
+}
+
+IndicatorWindow::IndicatorWindow(Core::ClassicDropIndicatorOverlay *controller, Core::View *)
+    : headless::View(controller, Core::ViewType::DropAreaIndicatorOverlay, nullptr)
+    , classicIndicators(controller)
+{
+    // A real top-level, so it can be shared between drop areas.
+    // Doesn't receive mouse events, the drag controller tells us where the mouse is.
+    enableAttribute(Qt::WA_TransparentForMouseEvents);
+}
+
+IndicatorWindow::~IndicatorWindow()
+{
+}
+
+DropLocation IndicatorWindow::hover(Point globalPos)
+{
+    return dropLocationAt(globalPos);
+}
+
+DropLocation IndicatorWindow::dropLocationAt(Point globalPos) const
+{
+    const Point localPos = mapFromGlobal(globalPos);
+    for (DropLocation loc : s_locations) {
+        if (!(m_visibleLocations & loc))
+            continue;
+
+        auto it = m_indicatorRects.find(loc);
+        if (it != m_indicatorRects.cend() && it->second.contains(localPos))
+            return loc;
+    }
+
+    return DropLocation_None;
+}
+
+void IndicatorWindow::updatePositions()
+{
+    const Rect r = rect();
+    const int halfIndicatorWidth = IndicatorSize / 2;
+    const Size indicatorSize(IndicatorSize, IndicatorSize);
+
+    m_indicatorRects[DropLocation_OutterLeft] = Rect(Point(r.x() + OutterIndicatorMargin, r.center().y() - halfIndicatorWidth), indicatorSize);
+    m_indicatorRects[DropLocation_OutterBottom] = Rect(Point(r.center().x() - halfIndicatorWidth, r.y() + height() - IndicatorSize - OutterIndicatorMargin), indicatorSize);
+    m_indicatorRects[DropLocation_OutterTop] = Rect(Point(r.center().x() - halfIndicatorWidth, r.y() + OutterIndicatorMargin), indicatorSize);
+    m_indicatorRects[DropLocation_OutterRight] = Rect(Point(r.x() + width() - IndicatorSize - OutterIndicatorMargin, r.center().y() - halfIndicatorWidth), indicatorSize);
+
+    if (Core::Group *hoveredGroup = classicIndicators->hoveredGroup()) {
+        const Rect hoveredRect = hoveredGroup->view()->geometry();
+        const Point center = r.topLeft() + hoveredRect.center() - Point(halfIndicatorWidth, halfIndicatorWidth);
+        const int offset = IndicatorSize + OutterIndicatorMargin;
+
+        m_indicatorRects[DropLocation_Center] = Rect(center, indicatorSize);
+        m_indicatorRects[DropLocation_Top] = Rect(center - Point(0, offset), indicatorSize);
+        m_indicatorRects[DropLocation_Right] = Rect(center + Point(offset, 0), indicatorSize);
+        m_indicatorRects[DropLocation_Bottom] = Rect(center + Point(0, offset), indicatorSize);
+        m_indicatorRects[DropLocation_Left] = Rect(center - Point(offset, 0), indicatorSize);
+    }
+}
+
+Point IndicatorWindow::posForIndicator(DropLocation loc) const
+{
+    auto it = m_indicatorRects.find(loc);
+    if (it == m_indicatorRects.cend())
+        return {};
+
+    return mapToGlobal(it->second.center());
+}
+
+void IndicatorWindow::raise()
+{
+    headless::View::raise();
+}
+
+void IndicatorWindow::setVisible(bool is)
+{
+    headless::View::setVisible(is);
+}
+
+bool IndicatorWindow::isWindow() const
+{
+    return true;
+}
+
+void IndicatorWindow::setGeometry(Rect geo)
+{
+    headless::View::setGeometry(geo);
+}
+
+void IndicatorWindow::resize(Size size)
+{
+    headless::View::resize(size);
+}
+
+void IndicatorWindow::setObjectName(const QString &name)
+{
+    setViewName(name);
+}
+
+void IndicatorWindow::updateIndicatorVisibility()
+{
+    m_visibleLocations = 0;
+    for (DropLocation loc : s_locations) {
+        if (classicIndicators->dropIndicatorVisible(loc))
+            m_visibleLocations |= loc;
+    }
+}
+
+bool IndicatorWindow::setClassicIndicators(Core::ClassicDropIndicatorOverlay *overlay)
+{
+    classicIndicators = overlay;
+    return true;
+}
+
+void IndicatorWindow::updateChildrenGeometry()
+{
+    // Same as QWidget::resizeEvent() in the QtWidgets frontend
+    updatePositions();
+}
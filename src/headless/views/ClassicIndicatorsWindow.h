@@ -0,0 +1,64 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "View.h"
+#include "core/views/ClassicIndicatorWindowViewInterface.h"
+
+#include <unordered_map>
+
+namespace KDDockWidgets {
+
+namespace Core {
+class ClassicDropIndicatorOverlay;
+}
+
+namespace headless {
+
+/// A top-level window holding the classic drop indicators.
+/// Indicators are just rects, laid out as in the QtWidgets frontend.
+class DOCKS_EXPORT IndicatorWindow : public headless::View, public Core::ClassicIndicatorWindowViewInterface
+{
+public:
+    static constexpr int IndicatorSize = 40;
+    static constexpr int OutterIndicatorMargin = 10;
+
+    explicit IndicatorWindow(Core::ClassicDropIndicatorOverlay *, Core::View *parent);
+    ~IndicatorWindow() override;
+
+    DropLocation hover(Point globalPos) override;
+    DropLocation dropLocationAt(Point globalPos) const override;
+    void updatePositions() override;
+    Point posForIndicator(DropLocation) const override;
+    void raise() override;
+    void setVisible(bool) override;
+    bool isWindow() const override;
+    void setGeometry(Rect) override;
+    void resize(Size) override;
+    void setObjectName(const QString &) override;
+    void updateIndicatorVisibility() override;
+    bool setClassicIndicators(Core::ClassicDropIndicatorOverlay *) override;
+
+protected:
+    void updateChildrenGeometry() override;
+
+private:
+    Core::ClassicDropIndicatorOverlay *classicIndicators;
+
+    /// Visible indicators, in local coordinates
+    std::unordered_map<int, Rect> m_indicatorRects;
+    int m_visibleLocations = 0;
+};
+
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "DockWidget.h"
+#include "ViewWrapper_p.h"
+
+#include "kddockwidgets/core/DockWidget.h"
+#include "core/DockWidget_p.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+DockWidget::DockWidget(const QString &uniqueName, DockWidgetOptions options,
+                       LayoutSaverOptions layoutSaverOptions)
+    : View(new Core::DockWidget(this, uniqueName, options, layoutSaverOptions), Core::ViewType::DockWidget,
+           nullptr)
+    , Core::DockWidgetViewInterface(asDockWidgetController())
+{
+    m_dockWidget->init();
+
+    m_dockWidget->dptr()->guestViewChanged.connect([this] {
+        if (auto guest = m_dockWidget->guestView()) {
+            guest->setVisible(true);
+            relayout();
+        }
+    });
+}
+
+DockWidget::~DockWidget()
+{
+}
+
+Size DockWidget::minSize() const
+{
+    if (auto guestWidget = dockWidget()->guestView()) {
+        // The guests min-size is the same as the widget's, there's no spacing or margins.
+        return guestWidget->minSize();
+    }
+
+    return View::minSize();
+}
+
+Size DockWidget::maxSizeHint() const
+{
+    if (auto guestWidget = dockWidget()->guestView()) {
+        // The guests max-size is the same as the widget's, there's no spacing or margins.
+        return guestWidget->maxSizeHint();
+    }
+
+    return View::maxSizeHint();
+}
+
+Core::DockWidget *DockWidget::dockWidget() const
+{
+    return m_dockWidget;
+}
+
+std::shared_ptr<Core::View> DockWidget::focusCandidate() const
+{
+    return ViewWrapper::create(const_cast<headless::DockWidget *>(this));
+}
+
+void DockWidget::updateChildrenGeometry()
+{
+    if (auto guest = m_dockWidget->guestView())
+        guest->setGeometry(rect());
+}
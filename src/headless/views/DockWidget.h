@@ -0,0 +1,48 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "kddockwidgets/core/views/DockWidgetViewInterface.h"
+#include "View.h"
+
+namespace KDDockWidgets::headless {
+
+/// A dock widget. Its guest view, if any, fills it.
+class DOCKS_EXPORT DockWidget : public headless::View,
+                                public Core::DockWidgetViewInterface
+{
+public:
+    explicit DockWidget(const QString &uniqueName, DockWidgetOptions options = {},
+                        LayoutSaverOptions layoutSaverOptions = {});
+    ~DockWidget() override;
+
+    Size minSize() const override;
+    Size maxSizeHint() const override;
+
+    Core::DockWidget *dockWidget() const;
+    std::shared_ptr<Core::View> focusCandidate() const override;
+
+    void show() override
+    {
+        Core::DockWidgetViewInterface::open();
+    }
+
+    void raise() override
+    {
+        Core::DockWidgetViewInterface::raise();
+    }
+
+protected:
+    void updateChildrenGeometry() override;
+};
+
+}
@@ -0,0 +1,31 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "DropArea.h"
+#include "kddockwidgets/core/DropArea.h"
+#include "core/View_p.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+DropArea::DropArea(Core::DropArea *dropArea, Core::View *parent)
+    : headless::View(dropArea, Core::ViewType::DropArea, parent)
+    , m_dropArea(dropArea)
+{
+    assert(dropArea);
+}
+
+DropArea::~DropArea()
+{
+    m_inDtor = true;
+    if (!d->freed())
+        m_dropArea->viewAboutToBeDeleted();
+}
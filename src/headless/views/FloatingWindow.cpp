@@ -0,0 +1,57 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "FloatingWindow.h"
+#include "TitleBar.h"
+
+#include "kddockwidgets/core/FloatingWindow.h"
+#include "kddockwidgets/core/DropArea.h"
+#include "kddockwidgets/core/TitleBar.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+FloatingWindow::FloatingWindow(Core::FloatingWindow *controller, Qt::WindowFlags windowFlags)
+    : View(controller, Core::ViewType::FloatingWindow, nullptr, windowFlags)
+    , m_controller(controller)
+{
+}
+
+void FloatingWindow::init()
+{
+    m_initialized = true;
+    relayout();
+}
+
+Size FloatingWindow::minSize() const
+{
+    if (!m_initialized)
+        return View::minSize();
+
+    return m_controller->dropArea()->view()->minSize() + Size(0, titleBarHeight());
+}
+
+int FloatingWindow::titleBarHeight() const
+{
+    return m_controller->titleBar()->view()->isExplicitlyHidden() ? 0 : TitleBar::Height;
+}
+
+void FloatingWindow::updateChildrenGeometry()
+{
+    if (!m_initialized || m_controller->beingDeleted())
+        return;
+
+    const int titleBarHeight = this->titleBarHeight();
+    if (titleBarHeight > 0)
+        m_controller->titleBar()->view()->setGeometry(Rect(0, 0, width(), titleBarHeight));
+
+    m_controller->dropArea()->view()->setGeometry(Rect(0, titleBarHeight, width(), height() - titleBarHeight));
+}
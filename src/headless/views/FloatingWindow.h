@@ -0,0 +1,44 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "View.h"
+
+namespace KDDockWidgets {
+
+namespace Core {
+class FloatingWindow;
+}
+
+namespace headless {
+
+/// A top-level window. The title bar goes on top, unless hidden, and the drop area fills the rest.
+class DOCKS_EXPORT FloatingWindow : public headless::View
+{
+public:
+    explicit FloatingWindow(Core::FloatingWindow *controller, Qt::WindowFlags windowFlags = {});
+
+    Size minSize() const override;
+
+protected:
+    void init() override;
+    void updateChildrenGeometry() override;
+
+private:
+    int titleBarHeight() const;
+    Core::FloatingWindow *const m_controller;
+    bool m_initialized = false;
+};
+
+}
+
+}
@@ -0,0 +1,100 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "Group.h"
+#include "TitleBar.h"
+#include "TabBar.h"
+
+#include "kddockwidgets/core/Group.h"
+#include "kddockwidgets/core/Stack.h"
+#include "kddockwidgets/core/TitleBar.h"
+#include "core/Group_p.h"
+#include "core/View_p.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+Group::Group(Core::Group *controller, Core::View *parent)
+    : View(controller, Core::ViewType::Group, parent)
+    , GroupViewInterface(controller)
+{
+}
+
+Group::~Group()
+{
+}
+
+void Group::init()
+{
+    m_initialized = true;
+
+    // The tab bar appears once there's more than one tab
+    m_numDockWidgetsConnection = m_group->dptr()->numDockWidgetsChanged.connect([this] {
+        asView_headless(m_group->stack())->relayout();
+        relayout();
+    });
+
+    relayout();
+}
+
+Size Group::minSize() const
+{
+    const Size contentsSize = m_group->dockWidgetsMinSize();
+    return contentsSize + Size(0, nonContentsHeight());
+}
+
+Size Group::maxSizeHint() const
+{
+    return View::maxSizeHint();
+}
+
+int Group::nonContentsHeight() const
+{
+    if (!m_initialized)
+        return 0;
+
+    int height = 0;
+    if (!m_group->titleBar()->view()->isExplicitlyHidden())
+        height += TitleBar::Height;
+
+    if (m_group->hasTabsVisible())
+        height += TabBar::Height;
+
+    return height;
+}
+
+Rect Group::dragRect() const
+{
+    // Dragging is done via the title bar or tab bar
+    return {};
+}
+
+void Group::updateChildrenGeometry()
+{
+    if (!m_initialized || m_group->inDtor())
+        return;
+
+    int y = 0;
+    auto titleBarView = m_group->titleBar()->view();
+    if (!titleBarView->isExplicitlyHidden()) {
+        titleBarView->setGeometry(Rect(0, 0, width(), TitleBar::Height));
+        y = TitleBar::Height;
+    }
+
+    m_group->stack()->view()->setGeometry(Rect(0, y, width(), height() - y));
+
+    const int nonContents = nonContentsHeight();
+    if (nonContents != m_lastNonContentsHeight) {
+        m_lastNonContentsHeight = nonContents;
+        // Our min-size changed
+        d->layoutInvalidated.emit();
+    }
+}
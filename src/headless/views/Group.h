@@ -0,0 +1,43 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "View.h"
+#include "core/views/GroupViewInterface.h"
+
+#include <kdbindings/signal.h>
+
+namespace KDDockWidgets::headless {
+
+/// The title bar goes on top and the stack fills the rest
+class DOCKS_EXPORT Group : public View, public Core::GroupViewInterface
+{
+public:
+    explicit Group(Core::Group *controller, Core::View *parent = nullptr);
+    ~Group() override;
+
+    Size minSize() const override;
+    Size maxSizeHint() const override;
+    Rect dragRect() const override;
+
+protected:
+    int nonContentsHeight() const override;
+    void init() override;
+    void updateChildrenGeometry() override;
+
+private:
+    bool m_initialized = false;
+    int m_lastNonContentsHeight = -1;
+    KDBindings::ScopedConnection m_numDockWidgetsConnection;
+};
+
+}
@@ -0,0 +1,66 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "MainWindow.h"
+#include "kddockwidgets/core/MainWindow.h"
+#include "kddockwidgets/core/Layout.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+MainWindow::MainWindow(const QString &uniqueName, MainWindowOptions options,
+                       headless::View *parent, Qt::WindowFlags flags)
+    : View(new Core::MainWindow(this, uniqueName, options), Core::ViewType::MainWindow, parent,
+           flags)
+    , MainWindowViewInterface(static_cast<Core::MainWindow *>(View::controller()))
+{
+    m_mainWindow->init(uniqueName);
+    updateChildrenGeometry();
+}
+
+MainWindow::~MainWindow()
+{
+}
+
+Size MainWindow::minSize() const
+{
+    if (auto layout = m_mainWindow->layout()) {
+        return layout->view()->minSize()
+            + Size(m_contentsMargins.left() + m_contentsMargins.right(),
+                   m_contentsMargins.top() + m_contentsMargins.bottom());
+    }
+
+    return View::minSize();
+}
+
+Margins MainWindow::centerWidgetMargins() const
+{
+    return {};
+}
+
+Rect MainWindow::centralAreaGeometry() const
+{
+    const Margins m = m_contentsMargins;
+    return rect().adjusted(m.left(), m.top(), -m.right(), -m.bottom());
+}
+
+void MainWindow::setContentsMargins(int left, int top, int right, int bottom)
+{
+    m_contentsMargins = Margins(left, top, right, bottom);
+    relayout();
+}
+
+void MainWindow::updateChildrenGeometry()
+{
+    // The layout fills the central area, which is what the side bars reserve space around
+    if (auto layout = m_mainWindow->layout())
+        layout->view()->setGeometry(centralAreaGeometry());
+}
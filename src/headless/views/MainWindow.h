@@ -0,0 +1,39 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "View.h"
+#include "kddockwidgets/core/views/MainWindowViewInterface.h"
+
+namespace KDDockWidgets::headless {
+
+/// A main window whose layout fills it, minus the contents margins
+class DOCKS_EXPORT MainWindow : public headless::View, public Core::MainWindowViewInterface
+{
+public:
+    explicit MainWindow(const QString &uniqueName, MainWindowOptions options = {},
+                        headless::View *parent = nullptr, Qt::WindowFlags flags = {});
+    ~MainWindow() override;
+
+    Size minSize() const override;
+
+protected:
+    Margins centerWidgetMargins() const override;
+    Rect centralAreaGeometry() const override;
+    void setContentsMargins(int left, int top, int right, int bottom) override;
+    void updateChildrenGeometry() override;
+
+private:
+    Margins m_contentsMargins;
+};
+
+}
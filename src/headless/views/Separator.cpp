@@ -0,0 +1,54 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "Separator.h"
+#include "kddockwidgets/core/Separator.h"
+#include "core/View_p.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+Separator::Separator(Core::Separator *controller, Core::View *parent)
+    : View(controller, Core::ViewType::Separator, parent)
+    , m_controller(controller)
+{
+}
+
+bool Separator::onMousePress(MouseEvent *)
+{
+    if (!Core::View::d->freed())
+        m_controller->onMousePress();
+    return true;
+}
+
+bool Separator::onMouseMove(MouseEvent *me)
+{
+    if (Core::View::d->freed())
+        return true;
+
+    // The controller wants the position in the layout's coordinates
+    m_controller->onMouseMove(me->pos() + pos());
+    return true;
+}
+
+bool Separator::onMouseRelease(MouseEvent *)
+{
+    if (!Core::View::d->freed())
+        m_controller->onMouseReleased();
+    return true;
+}
+
+bool Separator::onMouseDoubleClick(MouseEvent *)
+{
+    if (!Core::View::d->freed())
+        m_controller->onMouseDoubleClick();
+    return true;
+}
@@ -0,0 +1,41 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "View.h"
+
+namespace KDDockWidgets {
+
+namespace Core {
+class Separator;
+}
+
+namespace headless {
+
+/// Forwards the mouse to the separator controller, which resizes the neighbour items
+class DOCKS_EXPORT Separator : public headless::View
+{
+public:
+    explicit Separator(Core::Separator *controller, Core::View *parent = nullptr);
+
+    bool onMousePress(MouseEvent *) override;
+    bool onMouseMove(MouseEvent *) override;
+    bool onMouseRelease(MouseEvent *) override;
+    bool onMouseDoubleClick(MouseEvent *) override;
+
+private:
+    Core::Separator *const m_controller;
+};
+
+}
+
+}
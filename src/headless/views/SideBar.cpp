@@ -0,0 +1,30 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "SideBar.h"
+#include "kddockwidgets/core/SideBar.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+SideBar::SideBar(Core::SideBar *controller, Core::View *parent)
+    : View(controller, Core::ViewType::SideBar, parent)
+    , SideBarViewInterface(controller)
+{
+}
+
+void SideBar::addDockWidget_Impl(Core::DockWidget *)
+{
+}
+
+void SideBar::removeDockWidget_Impl(Core::DockWidget *)
+{
+}
@@ -0,0 +1,29 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "View.h"
+#include "core/views/SideBarViewInterface.h"
+
+namespace KDDockWidgets::headless {
+
+/// Side bars have no buttons to render, the controller tracks the dock widgets
+class DOCKS_EXPORT SideBar : public View, public Core::SideBarViewInterface
+{
+public:
+    explicit SideBar(Core::SideBar *, Core::View *parent);
+
+    void addDockWidget_Impl(Core::DockWidget *) override;
+    void removeDockWidget_Impl(Core::DockWidget *) override;
+};
+
+}
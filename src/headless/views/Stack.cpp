@@ -0,0 +1,65 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "Stack.h"
+#include "TabBar.h"
+
+#include "kddockwidgets/core/Stack.h"
+#include "kddockwidgets/core/TabBar.h"
+#include "kddockwidgets/core/Group.h"
+#include "kddockwidgets/core/DockWidget.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+Stack::Stack(Core::Stack *controller, Core::View *parent)
+    : View(controller, Core::ViewType::Stack, parent)
+    , StackViewInterface(controller)
+{
+}
+
+void Stack::setDocumentMode(bool)
+{
+}
+
+bool Stack::isPositionDraggable(Point) const
+{
+    return true;
+}
+
+void Stack::updateChildrenGeometry()
+{
+    Core::TabBar *tabBar = m_stack->tabBar();
+    Core::Group *group = m_stack->group();
+    if (!tabBar || !group || group->inDtor())
+        return;
+
+    const bool tabsVisible = group->hasTabsVisible();
+    tabBar->view()->setVisible(tabsVisible);
+
+    int y = 0;
+    if (tabsVisible) {
+        tabBar->view()->setGeometry(Rect(0, 0, width(), TabBar::Height));
+        y = TabBar::Height;
+    }
+
+    Core::DockWidget *current = tabBar->currentDockWidget();
+    const int count = tabBar->numDockWidgets();
+    for (int i = 0; i < count; ++i) {
+        Core::DockWidget *dw = tabBar->dockWidgetAt(i);
+        if (dw == current) {
+            dw->view()->setGeometry(Rect(0, y, width(), height() - y));
+            dw->view()->setVisible(true);
+        } else {
+            dw->view()->setVisible(false);
+        }
+    }
+}
@@ -0,0 +1,109 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "TabBar.h"
+#include "kddockwidgets/core/TabBar.h"
+#include "kddockwidgets/core/Stack.h"
+#include "kddockwidgets/core/DockWidget.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+TabBar::TabBar(Core::TabBar *controller, Core::View *parent)
+    : View(controller, Core::ViewType::TabBar, parent)
+    , TabBarViewInterface(controller)
+    , m_controller(controller)
+{
+}
+
+int TabBar::tabAt(Point localPos) const
+{
+    if (localPos.x() < 0 || localPos.y() < 0 || localPos.y() >= height())
+        return -1;
+
+    const int index = localPos.x() / TabWidth;
+    return index < m_titles.size() ? index : -1;
+}
+
+QString TabBar::text(int index) const
+{
+    return m_titles.value(index);
+}
+
+Rect TabBar::rectForTab(int index) const
+{
+    if (index < 0 || index >= m_titles.size())
+        return {};
+
+    return Rect(index * TabWidth, 0, TabWidth, height());
+}
+
+void TabBar::moveTabTo(int from, int to)
+{
+    if (from < 0 || from >= m_titles.size() || to < 0 || to >= m_titles.size())
+        return;
+
+    const QString title = m_titles.takeAt(from);
+    m_titles.insert(to, title);
+}
+
+void TabBar::changeTabIcon(int, const Icon &)
+{
+}
+
+void TabBar::removeDockWidget(Core::DockWidget *dw)
+{
+    const int index = m_controller->indexOfDockWidget(dw);
+    if (index >= 0 && index < m_titles.size())
+        m_titles.removeAt(index);
+
+    relayoutStack();
+}
+
+void TabBar::insertDockWidget(int index, Core::DockWidget *dw, const Icon &,
+                              const QString &title)
+{
+    m_titles.insert(std::min(index, int(m_titles.size())), title);
+
+    // As with QTabWidget, the dock widget goes into the stack, not in the tab bar
+    dw->view()->setParent(m_controller->stack()->view());
+
+    relayoutStack();
+}
+
+void TabBar::renameTab(int index, const QString &name)
+{
+    if (index >= 0 && index < m_titles.size())
+        m_titles[index] = name;
+}
+
+void TabBar::setCurrentIndex(int)
+{
+    relayoutStack();
+}
+
+bool TabBar::onMousePress(MouseEvent *me)
+{
+    m_controller->onMousePress(me->pos());
+    return true;
+}
+
+bool TabBar::onMouseDoubleClick(MouseEvent *me)
+{
+    m_controller->onMouseDoubleClick(me->pos());
+    return true;
+}
+
+void TabBar::relayoutStack()
+{
+    if (auto stack = m_controller->stack())
+        asView_headless(stack)->relayout();
+}
@@ -0,0 +1,52 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "View.h"
+#include "core/views/TabBarViewInterface.h"
+
+namespace KDDockWidgets::Core {
+class TabBar;
+}
+
+namespace KDDockWidgets::headless {
+
+/// A tab bar where every tab is TabWidth wide
+class DOCKS_EXPORT TabBar : public View, public Core::TabBarViewInterface
+{
+public:
+    static constexpr int Height = 30;
+    static constexpr int TabWidth = 100;
+
+    explicit TabBar(Core::TabBar *controller, Core::View *parent = nullptr);
+
+    int tabAt(Point localPos) const override;
+    QString text(int index) const override;
+    Rect rectForTab(int index) const override;
+    void moveTabTo(int from, int to) override;
+    void changeTabIcon(int index, const Icon &icon) override;
+    void removeDockWidget(Core::DockWidget *dw) override;
+    void insertDockWidget(int index, Core::DockWidget *dw, const Icon &icon,
+                          const QString &title) override;
+    void renameTab(int index, const QString &name) override;
+    void setCurrentIndex(int index) override;
+
+    bool onMousePress(MouseEvent *) override;
+    bool onMouseDoubleClick(MouseEvent *) override;
+
+private:
+    void relayoutStack();
+    Core::TabBar *const m_controller;
+    Vector<QString> m_titles;
+};
+
+}
@@ -0,0 +1,54 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "TitleBar.h"
+
+#include "kddockwidgets/core/TitleBar.h"
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+TitleBar::TitleBar(Core::TitleBar *controller, Core::View *parent)
+    : View(controller, Core::ViewType::TitleBar, parent)
+    , Core::TitleBarViewInterface(controller)
+{
+}
+
+TitleBar::~TitleBar()
+{
+}
+
+void TitleBar::init()
+{
+    setFixedHeight(Height);
+}
+
+bool TitleBar::onMouseDoubleClick(MouseEvent *)
+{
+    return m_titleBar->onDoubleClicked();
+}
+
+#ifdef DOCKS_TESTING_METHODS
+bool TitleBar::isCloseButtonEnabled() const
+{
+    return true;
+}
+
+bool TitleBar::isCloseButtonVisible() const
+{
+    return true;
+}
+
+bool TitleBar::isFloatButtonVisible() const
+{
+    return true;
+}
+#endif
@@ -0,0 +1,43 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "View.h"
+#include "core/views/TitleBarViewInterface.h"
+
+namespace KDDockWidgets::Core {
+class TitleBar;
+}
+
+namespace KDDockWidgets::headless {
+
+class DOCKS_EXPORT TitleBar : public View, public Core::TitleBarViewInterface
+{
+public:
+    static constexpr int Height = 30;
+
+    explicit TitleBar(Core::TitleBar *controller, Core::View *parent = nullptr);
+    ~TitleBar() override;
+
+    bool onMouseDoubleClick(MouseEvent *) override;
+
+protected:
+#ifdef DOCKS_TESTING_METHODS
+    bool isCloseButtonEnabled() const override;
+    bool isCloseButtonVisible() const override;
+    bool isFloatButtonVisible() const override;
+#endif
+
+    void init() override;
+};
+
+}
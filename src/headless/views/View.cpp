@@ -0,0 +1,534 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#include "View.h"
+#include "ViewWrapper_p.h"
+#include "../Platform.h"
+#include "../Window_p.h"
+#include "core/View_p.h"
+#include "core/ScopedValueRollback_p.h"
+#include "core/layouting/Item_p.h"
+#include "kddockwidgets/core/DockRegistry.h"
+#include "kddockwidgets/core/DockWidget.h"
+
+#include <algorithm>
+#include <utility>
+
+using namespace KDDockWidgets;
+using namespace KDDockWidgets::headless;
+
+View::View(Core::Controller *controller, Core::ViewType type, Core::View *parent,
+           Qt::WindowFlags windowFlags)
+    : Core::View(controller, type)
+    , m_windowFlags(windowFlags)
+{
+    m_minSize = Core::Item::hardcodedMinimumSize;
+    m_maxSize = Core::Item::hardcodedMaximumSize;
+    m_geometry = Rect(0, 0, 400, 400);
+
+    if (parent) {
+        setParent(parent);
+    } else {
+        Platform::platformHeadless()->onRootViewAdded(this);
+    }
+
+    m_inCtor = false;
+}
+
+View::~View()
+{
+    m_inDtor = true;
+
+    Platform::platformHeadless()->onViewDestroyed(this);
+
+    if (m_parentView) {
+        setParent(nullptr);
+    }
+}
+
+void View::setGeometry(Rect geo)
+{
+    if (geo == m_geometry)
+        return;
+
+    const Size oldSize = m_geometry.size();
+    m_geometry = geo;
+    if (oldSize != geo.size())
+        onSizeChanged();
+}
+
+void View::move(int x, int y)
+{
+    m_geometry.moveTopLeft(Point(x, y));
+}
+
+bool View::close()
+{
+    CloseEvent ev;
+    d->requestClose(&ev);
+
+    if (ev.isAccepted()) {
+        setVisible(false);
+        return true;
+    }
+
+    return false;
+}
+
+bool View::isVisible() const
+{
+    // No value means false
+    if (!m_visible.value_or(false))
+        return false;
+
+    // Parents need to be visible as well
+    return !m_parentView || m_parentView->isVisible();
+}
+
+void View::setVisible(bool is)
+{
+    if (m_visible.has_value() && is == m_visible.value())
+        return;
+
+    m_visible = is;
+
+    if (is) {
+        if (auto dw = asDockWidgetController())
+            dw->createPendingGuestView();
+
+        // Mimic QWidgets: Set children visible, unless they were explicitly hidden
+        for (auto child : std::as_const(m_childViews)) {
+            if (!child->isExplicitlyHidden())
+                child->setVisible(true);
+        }
+
+        // A window being shown goes on top of the others
+        if (!m_parentView)
+            Platform::platformHeadless()->onRootViewRaised(this);
+
+        relayout();
+    }
+
+    if (m_parentView)
+        m_parentView->relayout();
+}
+
+bool View::isExplicitlyHidden() const
+{
+    return m_visible.has_value() && !m_visible.value();
+}
+
+void View::setSize(int w, int h)
+{
+    setGeometry(Rect(m_geometry.topLeft(), Size(w, h)));
+}
+
+std::shared_ptr<Core::View> View::rootView() const
+{
+    if (m_parentView)
+        return m_parentView->rootView();
+
+    return const_cast<View *>(this)->asWrapper();
+}
+
+void View::enableAttribute(Qt::WidgetAttribute attr, bool enable)
+{
+    if (attr == Qt::WA_TransparentForMouseEvents)
+        m_transparentForMouseEvents = enable;
+}
+
+bool View::hasAttribute(Qt::WidgetAttribute attr) const
+{
+    if (attr == Qt::WA_TransparentForMouseEvents)
+        return m_transparentForMouseEvents;
+
+    return false;
+}
+
+void View::setFlag(Qt::WindowType flag, bool on)
+{
+    if (on) {
+        m_windowFlags |= flag;
+    } else {
+        m_windowFlags &= ~flag;
+    }
+}
+
+Qt::WindowFlags View::flags() const
+{
+    return m_windowFlags;
+}
+
+Size View::minSize() const
+{
+    return m_minSize;
+}
+
+Size View::maxSizeHint() const
+{
+    return m_maxSize;
+}
+
+Rect View::geometry() const
+{
+    return m_geometry;
+}
+
+Rect View::normalGeometry() const
+{
+    return m_geometry;
+}
+
+void View::setNormalGeometry(Rect)
+{
+}
+
+void View::setMaximumSize(Size s)
+{
+    s = s.boundedTo(Core::Item::hardcodedMaximumSize);
+    if (s != m_maxSize) {
+        m_maxSize = s;
+        d->layoutInvalidated.emit();
+    }
+}
+
+void View::setWidth(int w)
+{
+    setSize(w, m_geometry.height());
+}
+
+void View::setHeight(int h)
+{
+    setSize(m_geometry.width(), h);
+}
+
+void View::setFixedWidth(int w)
+{
+    setWidth(w);
+}
+
+void View::setFixedHeight(int h)
+{
+    setHeight(h);
+}
+
+void View::show()
+{
+    setVisible(true);
+}
+
+void View::hide()
+{
+    setVisible(false);
+}
+
+void View::updateGeometry()
+{
+}
+
+void View::update()
+{
+}
+
+void View::setParent(Core::View *parentView)
+{
+    // Might be a wrapper
+    View *parent = asView_headless(parentView);
+    if (parent == m_parentView)
+        return;
+
+    auto oldParent = m_parentView;
+    m_parentView = parent;
+
+    if (oldParent) {
+        oldParent->m_childViews.erase(std::remove_if(oldParent->m_childViews.begin(), oldParent->m_childViews.end(),
+                                                     [this](Core::View *v) {
+                                                         return v->equals(this);
+                                                     }),
+                                      oldParent->m_childViews.end());
+        // No relayout when we're being deleted, the controllers might be half-destroyed
+        if (!oldParent->inDtor() && !m_inDtor)
+            oldParent->relayout();
+    } else {
+        Platform::platformHeadless()->onRootViewRemoved(this);
+    }
+
+    if (m_parentView) {
+        m_parentView->m_childViews.append(this);
+
+        if (!m_parentView->isVisible() && isExplicitlyHidden()) {
+            // Mimic QtWidget. Parenting removes the explicit hidden attribute if the parent is not visible
+            m_visible = std::nullopt;
+        }
+
+        m_parentView->relayout();
+    } else if (!m_inDtor) {
+        // Mimic Qt and hide when unparenting
+        setVisible(false);
+        Platform::platformHeadless()->onRootViewAdded(this);
+    }
+}
+
+void View::raiseAndActivate()
+{
+    raise();
+    activateWindow();
+}
+
+void View::activateWindow()
+{
+}
+
+void View::raise()
+{
+    if (isRootView()) {
+        Platform::platformHeadless()->onRootViewRaised(this);
+        if (auto fw = asFloatingWindowController())
+            DockRegistry::self()->onFloatingWindowRaised(fw);
+    } else {
+        auto &siblings = m_parentView->m_childViews;
+        auto it = std::find(siblings.begin(), siblings.end(), this);
+        if (it != siblings.end()) {
+            siblings.erase(it);
+            siblings.append(this);
+        }
+    }
+}
+
+bool View::isRootView() const
+{
+    return m_parentView == nullptr;
+}
+
+Point View::mapToGlobal(Point localPt) const
+{
+    const Point pt = localPt + m_geometry.topLeft();
+    return m_parentView ? m_parentView->mapToGlobal(pt) : pt;
+}
+
+Point View::mapFromGlobal(Point globalPt) const
+{
+    return globalPt - mapToGlobal(Point(0, 0));
+}
+
+Point View::mapTo(Core::View *other, Point pt) const
+{
+    if (!other)
+        return {};
+
+    if (other->equals(this))
+        return pt;
+
+    const Point global = mapToGlobal(pt);
+    return other->mapFromGlobal(global);
+}
+
+void View::setWindowOpacity(double)
+{
+}
+
+void View::setWindowTitle(const QString &)
+{
+}
+
+void View::setWindowIcon(const Icon &)
+{
+}
+
+bool View::isActiveWindow() const
+{
+    return false;
+}
+
+void View::showNormal()
+{
+    setVisible(true);
+}
+
+void View::showMinimized()
+{
+    setVisible(true);
+}
+
+void View::showMaximized()
+{
+    setVisible(true);
+}
+
+bool View::isMinimized() const
+{
+    return false;
+}
+
+bool View::isMaximized() const
+{
+    return false;
+}
+
+std::shared_ptr<Core::Window> View::window() const
+{
+    return std::make_shared<headless::Window>(rootView());
+}
+
+std::shared_ptr<Core::View> View::childViewAt(Point localPos) const
+{
+    if (!rect().contains(localPos))
+        return nullptr;
+
+    // Top-most child first, depth first
+    for (auto it = m_childViews.crbegin(); it != m_childViews.crend(); ++it) {
+        auto child = static_cast<View *>(*it);
+        if (!child->isVisible() || child->m_transparentForMouseEvents)
+            continue;
+
+        if (auto result = child->childViewAt(localPos - child->m_geometry.topLeft()))
+            return result;
+    }
+
+    return const_cast<View *>(this)->asWrapper();
+}
+
+std::shared_ptr<Core::View> View::parentView() const
+{
+    if (m_parentView)
+        return m_parentView->asWrapper();
+
+    return {};
+}
+
+std::shared_ptr<Core::View> View::asWrapper()
+{
+    return ViewWrapper::create(this);
+}
+
+void View::setViewName(const QString &name)
+{
+    m_name = name;
+}
+
+void View::grabMouse()
+{
+    Platform::platformHeadless()->setMouseGrabber(this);
+}
+
+void View::releaseMouse()
+{
+    Platform::platformHeadless()->ungrabMouse();
+}
+
+void View::releaseKeyboard()
+{
+}
+
+void View::setFocus(Qt::FocusReason)
+{
+    Platform::platformHeadless()->setFocusedView(asWrapper());
+}
+
+bool View::hasFocus() const
+{
+    auto focusedView = Platform::platformHeadless()->focusedView();
+    return focusedView && focusedView->equals(this);
+}
+
+Qt::FocusPolicy View::focusPolicy() const
+{
+    return {};
+}
+
+void View::setFocusPolicy(Qt::FocusPolicy)
+{
+}
+
+QString View::viewName() const
+{
+    return m_name;
+}
+
+void View::setMinimumSize(Size s)
+{
+    s = s.expandedTo(Core::Item::hardcodedMinimumSize);
+    if (s != m_minSize) {
+        m_minSize = s;
+        d->layoutInvalidated.emit();
+    }
+}
+
+void View::render(QPainter *)
+{
+}
+
+void View::setCursor(Qt::CursorShape)
+{
+}
+
+void View::setMouseTracking(bool)
+{
+}
+
+Vector<std::shared_ptr<Core::View>> View::childViews() const
+{
+    Vector<std::shared_ptr<Core::View>> children;
+    children.reserve(m_childViews.size());
+    for (auto child : m_childViews)
+        children.append(ViewWrapper::create(static_cast<headless::View *>(child)));
+
+    return children;
+}
+
+void View::setZOrder(int)
+{
+}
+
+Core::HANDLE View::handle() const
+{
+    return this;
+}
+
+bool View::onMouseEvent(MouseEvent *me)
+{
+    switch (me->type()) {
+    case Event::MouseButtonPress:
+        return onMousePress(me);
+    case Event::MouseMove:
+        return onMouseMove(me);
+    case Event::MouseButtonRelease:
+        return onMouseRelease(me);
+    case Event::MouseButtonDblClick:
+        return onMouseDoubleClick(me);
+    default:
+        break;
+    }
+
+    return false;
+}
+
+void View::updateChildrenGeometry()
+{
+}
+
+void View::relayout()
+{
+    if (m_inCtor || m_inDtor || m_inRelayout)
+        return;
+
+    ScopedValueRollback guard(m_inRelayout, true);
+    updateChildrenGeometry();
+}
+
+void View::onSizeChanged()
+{
+    if (m_inCtor)
+        return;
+
+    relayout();
+    onResize(m_geometry.width(), m_geometry.height());
+}
@@ -0,0 +1,174 @@
+/*
+  This file is part of KDDockWidgets.
+
+  SPDX-FileCopyrightText: 2024 Klarälvdalens Datakonsult AB, a KDAB Group company <info@kdab.com>
+  Author: Sérgio Martins <sergio.martins@kdab.com>
+
+  SPDX-License-Identifier: GPL-2.0-only OR GPL-3.0-only
+
+  Contact KDAB at <info@kdab.com> for commercial licensing options.
+*/
+
+#pragma once
+
+#include "kddockwidgets/core/Controller.h"
+#include "kddockwidgets/core/View.h"
+
+#include <memory>
+#include <optional>
+
+namespace KDDockWidgets::headless {
+
+/// A view which only exists in memory. Geometry is stored, not rendered.
+/// Views without parent are windows and their geometry is in global coordinates.
+class DOCKS_EXPORT View : public Core::View
+{
+public:
+    using Core::View::close;
+    using Core::View::resize;
+
+    explicit View(Core::Controller *controller, Core::ViewType type, Core::View *,
+                  Qt::WindowFlags windowFlags = {});
+
+    ~View() override;
+
+    Size minSize() const override;
+    Size maxSizeHint() const override;
+    Rect geometry() const override;
+    Rect normalGeometry() const override;
+    void setNormalGeometry(Rect geo);
+    void setGeometry(Rect geometry) override;
+    void setMaximumSize(Size sz) override;
+
+    bool isVisible() const override;
+    void setVisible(bool visible) override;
+    bool isExplicitlyHidden() const override;
+
+    void move(int x, int y) override;
+    void setSize(int w, int h) override;
+
+    void setWidth(int w) override;
+    void setHeight(int h) override;
+    void setFixedWidth(int w) override;
+    void setFixedHeight(int h) override;
+    void show() override;
+    void hide() override;
+    void updateGeometry();
+    void update() override;
+    void setParent(Core::View *parent) override;
+    void raiseAndActivate() override;
+    void activateWindow() override;
+    void raise() override;
+    bool isRootView() const override;
+    Point mapToGlobal(Point localPt) const override;
+    Point mapFromGlobal(Point globalPt) const override;
+    Point mapTo(Core::View *parent, Point pos) const override;
+    void setWindowOpacity(double v) override;
+
+    bool close() override;
+    void setFlag(Qt::WindowType f, bool on = true) override;
+    void enableAttribute(Qt::WidgetAttribute attr, bool enable = true) override;
+    bool hasAttribute(Qt::WidgetAttribute attr) const override;
+    Qt::WindowFlags flags() const override;
+
+    void setWindowTitle(const QString &title) override;
+    void setWindowIcon(const Icon &icon) override;
+    bool isActiveWindow() const override;
+
+    void showNormal() override;
+    void showMinimized() override;
+    void showMaximized() override;
+
+    bool isMinimized() const override;
+    bool isMaximized() const override;
+
+    std::shared_ptr<Core::Window> window() const override;
+    std::shared_ptr<Core::View> childViewAt(Point p) const override;
+    std::shared_ptr<Core::View> rootView() const override;
+    std::shared_ptr<Core::View> parentView() const override;
+    std::shared_ptr<Core::View> asWrapper() override;
+
+    void setViewName(const QString &name) override;
+    void grabMouse() override;
+    void releaseMouse() override;
+    void releaseKeyboard() override;
+    void setFocus(Qt::FocusReason reason) override;
+    Qt::FocusPolicy focusPolicy() const override;
+    bool hasFocus() const override;
+    void setFocusPolicy(Qt::FocusPolicy policy) override;
+    QString viewName() const override;
+    void setMinimumSize(Size sz) override;
+    void render(QPainter *) override;
+    void setCursor(Qt::CursorShape shape) override;
+    void setMouseTracking(bool enable) override;
+    Vector<std::shared_ptr<Core::View>> childViews() const override;
+    void setZOrder(int z) override;
+    Core::HANDLE handle() const override;
+
+    /// Called by the platform when a mouse event is received, after the view's event filters.
+    /// Dispatches to the handlers below. Returns true if the event was accepted, otherwise it
+    /// propagates to the parent.
+    bool onMouseEvent(MouseEvent *);
+
+    /// Views can override if they're interested in events which the event filters rejected
+    virtual bool onMousePress(MouseEvent *)
+    {
+        return false;
+    }
+
+    virtual bool onMouseMove(MouseEvent *)
+    {
+        return false;
+    }
+
+    virtual bool onMouseRelease(MouseEvent *)
+    {
+        return false;
+    }
+
+    virtual bool onMouseDoubleClick(MouseEvent *)
+    {
+        return false;
+    }
+
+    /// Calls updateChildrenGeometry(), unless already doing so
+    void relayout();
+
+protected:
+    /// Positions the children, as a QLayout would.
+    /// Called when this view is resized or when a child is added, removed, shown or hidden.
+    /// The default implementation does nothing, children keep their geometry.
+    virtual void updateChildrenGeometry();
+
+private:
+    void onSizeChanged();
+
+    View *m_parentView = nullptr;
+    QString m_name;
+    Size m_minSize;
+    Size m_maxSize;
+    Rect m_geometry;
+    std::optional<bool> m_visible;
+    Qt::WindowFlags m_windowFlags;
+    bool m_transparentForMouseEvents = false;
+    bool m_inCtor = true;
+    bool m_inRelayout = false;
+    KDDW_DELETE_COPY_CTOR(View)
+};
+
+inline View *asView_headless(Core::View *view)
+{
+    if (!view)
+        return nullptr;
+    return static_cast<View *>(view->handle() ? const_cast<void *>(view->handle()) : nullptr);
+}
+
+inline View *asView_headless(Core::Controller *controller)
+{
+    if (!controller)
+        return nullptr;
+
+    return asView_headless(controller->view());
+}
+
+} // namespace KDDockWidgets::headless
@@ -230,6 +230,18 @@ int Platform_qt::screenNumberForWindow(std::shared_ptr<Core::Window> window) con
     return screenNumberForQWindow(static_cast<Window *>(window.get())->qtWindow());
 }
 
+double Platform_qt::screenRefreshRateFor(Core::View *view) const
+{
+    QScreen *screen = nullptr;
+    if (auto window = view ? view->window() : nullptr)
+        screen = static_cast<Window *>(window.get())->qtWindow()->screen();
+
+    if (!screen)
+        screen = qGuiApp->primaryScreen();
+
+    return screen ? screen->refreshRate() : Core::Platform::screenRefreshRateFor(view);
+}
+
 int Platform_qt::screenNumberForQWindow(QWindow *window) const
 {
     if (QScreen *screen = window->screen()) {
@@ -13,10 +13,18 @@
 #include "core/View_p.h"
 
 #include <QDebug>
+#include <QHash>
 
 using namespace KDDockWidgets;
 using namespace KDDockWidgets::QtCommon;
 
+static QHash<const QObject *, ViewWrapper::Ptr> &wrapperCache()
+{
+    // Intentionally leaked, wrappers must not outlive the platform at static destruction time.
+    // Entries are removed as their QObjects get destroyed anyway.
+    static auto cache = new QHash<const QObject *, ViewWrapper::Ptr>();
+    return *cache;
+}
 
 ViewWrapper::ViewWrapper(Core::Controller *controller, QObject *thisObj)
     : View_qt(controller, Core::ViewType::ViewWrapper, thisObj)
@@ -32,6 +40,36 @@ ViewWrapper::~ViewWrapper()
     }
 }
 
+bool ViewWrapper::ownsController() const
+{
+    return m_ownsController;
+}
+
+ViewWrapper::Ptr ViewWrapper::cachedWrapper(QObject *obj)
+{
+    return wrapperCache().value(obj);
+}
+
+void ViewWrapper::cacheWrapper(QObject *obj, const Ptr &wrapper)
+{
+    auto &cache = wrapperCache();
+    const bool isNew = !cache.contains(obj);
+    cache.insert(obj, wrapper);
+
+    if (isNew) {
+        QObject::connect(obj, &QObject::destroyed, [obj] {
+            // Take it out first, as the wrapper's dtor might re-enter the cache
+            const Ptr wrapper = wrapperCache().take(obj);
+            Q_UNUSED(wrapper);
+        });
+    }
+}
+
+int ViewWrapper::numCachedWrappers()
+{
+    return wrapperCache().size();
+}
+
 void ViewWrapper::setMinimumSize(QSize)
 {
     qFatal("Not implemented");
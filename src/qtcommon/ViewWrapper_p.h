@@ -61,6 +61,21 @@ public:
     void setMouseTracking(bool) override;
     std::shared_ptr<View> asWrapper() override;
 
+    /// @brief Returns whether this wrapper created a dummy controller, as the wrapped object
+    /// isn't backed by one
+    bool ownsController() const;
+
+    /// @brief Returns the wrapper previously cached for @p obj, if any
+    /// Wrappers are cached per QObject so parent walks and hit tests don't allocate a new
+    /// wrapper (and event filter) at each step. Entries are dropped when the QObject is destroyed.
+    static Ptr cachedWrapper(QObject *obj);
+
+    /// @brief Caches @p wrapper for @p obj, replacing any previous entry
+    static void cacheWrapper(QObject *obj, const Ptr &wrapper);
+
+    /// @brief Returns the number of cached wrappers. For tests.
+    static int numCachedWrappers();
+
 private:
     Q_DISABLE_COPY(ViewWrapper)
     const bool m_ownsController;
@@ -106,6 +106,12 @@ public:
         return *this;
     }
 
+    QFlags &operator|=(QFlags rhs)
+    {
+        m_value |= rhs.m_value;
+        return *this;
+    }
+
     QFlags operator|(T rhs) const
     {
         QFlags<T> result = *this;
@@ -28,6 +28,9 @@
 #include "views/DockWidget.h"
 #include "DockWidgetInstantiator.h"
 
+#include <QFile>
+#include <QHash>
+#include <QQmlComponent>
 #include <QQmlEngine>
 #include <QQuickStyle>
 #include <QQuickWindow>
@@ -156,6 +159,91 @@ QSize Platform::screenSizeFor(Core::View *view) const
     return {};
 }
 
+namespace {
+
+inline QString cleanQRCFilename(const QString &filename)
+{
+    // QFile doesn't understand qrc:/ only :/
+
+    if (filename.startsWith(QStringLiteral("qrc:/")))
+        return filename.right(filename.size() - 3);
+
+    return filename;
+}
+
+/// Holds the compiled components of a QQmlEngine. Child of the engine, so it dies with it.
+class QmlComponentCache : public QObject
+{
+public:
+    explicit QmlComponentCache(QQmlEngine *engine)
+        : QObject(engine)
+    {
+    }
+
+    static QmlComponentCache *forEngine(QQmlEngine *engine)
+    {
+        const char *propertyName = "kddockwidgets_qmlComponentCache";
+        if (auto cache = engine->property(propertyName).value<QObject *>())
+            return static_cast<QmlComponentCache *>(cache);
+
+        auto cache = new QmlComponentCache(engine);
+        engine->setProperty(propertyName, QVariant::fromValue<QObject *>(cache));
+        return cache;
+    }
+
+    QHash<QString, QQmlComponent *> m_components;
+};
+
+}
+
+QQmlComponent *Platform::qmlComponent(QQmlEngine *engine, const QString &filename)
+{
+    auto cache = QmlComponentCache::forEngine(engine);
+    QQmlComponent *component = cache->m_components.value(filename);
+
+    if (component && component->isLoading()) {
+        // Still compiling in the background, but it's needed now.
+        // QML's type loader has done part of the work already, so loading synchronously is cheap.
+        delete component;
+        component = nullptr;
+    }
+
+    if (!component) {
+        if (!QFile::exists(cleanQRCFilename(filename))) {
+            qWarning() << Q_FUNC_INFO << "File not found" << filename;
+            cache->m_components.remove(filename);
+            return nullptr;
+        }
+
+        component = new QQmlComponent(engine, filename, cache);
+        cache->m_components.insert(filename, component);
+    }
+
+    return component;
+}
+
+void Platform::precompileQmlComponents(QQmlEngine *engine)
+{
+    ViewFactory *factory = viewFactory();
+    const QUrl urls[] = { factory->titleBarFilename(), factory->tabbarFilename(),
+                          factory->dockwidgetFilename(), factory->groupFilename(),
+                          factory->floatingWindowFilename(), factory->separatorFilename(),
+                          factory->rubberBandFilename() };
+
+    auto cache = QmlComponentCache::forEngine(engine);
+    for (const QUrl &url : urls) {
+        const QString filename = url.toString();
+        if (filename.isEmpty() || cache->m_components.contains(filename))
+            continue;
+
+        if (!QFile::exists(cleanQRCFilename(filename)))
+            continue; // Will warn when actually used
+
+        cache->m_components.insert(
+            filename, new QQmlComponent(engine, filename, QQmlComponent::Asynchronous, cache));
+    }
+}
+
 QQmlEngine *Platform::qmlEngine() const
 {
     if (!m_qmlEngine)
@@ -184,6 +272,8 @@ void Platform::setQmlEngine(QQmlEngine *qmlEngine)
     context->setContextProperty(QStringLiteral("_kddwDockRegistry"), dr);
     context->setContextProperty(QStringLiteral("_kddw_widgetFactory"),
                                 Config::self().viewFactory());
+
+    precompileQmlComponents(qmlEngine);
 }
 
 ViewFactory *Platform::viewFactory() const
@@ -18,6 +18,7 @@
 
 QT_BEGIN_NAMESPACE
 class QQmlEngine;
+class QQmlComponent;
 class QQuickItem;
 QT_END_NAMESPACE
 
@@ -50,6 +51,12 @@ public:
     QSize screenSizeFor(Core::View *) const override;
     void setQmlEngine(QQmlEngine *);
     QQmlEngine *qmlEngine() const;
+
+    /// @brief Returns the QQmlComponent for @p filename, compiling it on first use
+    /// Components are cached per engine, so creating many views doesn't recompile the same QML.
+    /// setQmlEngine() already starts compiling the ViewFactory's files in the background.
+    /// Returns nullptr if the file doesn't exist.
+    QQmlComponent *qmlComponent(QQmlEngine *engine, const QString &filename);
     Core::View *createView(Core::Controller *controller, Core::View *parent = nullptr) const override;
     bool usesFallbackMouseGrabber() const override;
     bool inDisallowedDragView(QPoint globalPos) const override;
@@ -73,6 +80,7 @@ public:
 #endif
 private:
     void init();
+    void precompileQmlComponents(QQmlEngine *engine);
     QPointer<QQmlEngine> m_qmlEngine;
     QtQuickHelpers *const m_qquickHelpers;
     Q_DISABLE_COPY(Platform)
@@ -200,7 +200,12 @@ QUrl ViewFactory::tabbarFilename() const
 
 QUrl ViewFactory::separatorFilename() const
 {
-    return QUrl(QStringLiteral("qrc:/kddockwidgets/qtquick/views/qml/Separator.qml"));
+    return {};
+}
+
+QUrl ViewFactory::rubberBandFilename() const
+{
+    return {};
 }
 
 Core::View *
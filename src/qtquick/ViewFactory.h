@@ -80,8 +80,17 @@ public:
     virtual QUrl dockwidgetFilename() const;
     virtual QUrl groupFilename() const;
     virtual QUrl floatingWindowFilename() const;
+
+    /// Returns the QML file for styling separators
+    /// Empty by default, meaning separators are rendered natively in C++, which is much cheaper
+    /// when there are many. Return "qrc:/kddockwidgets/qtquick/views/qml/Separator.qml" to get the
+    /// old QML based separator.
     virtual QUrl separatorFilename() const;
 
+    /// Returns the QML file for styling the rubber band shown while resizing with lazy resize
+    /// Empty by default, meaning the rubber band is rendered natively in C++.
+    virtual QUrl rubberBandFilename() const;
+
     KDDockWidgets::Core::Action *createAction(Core::DockWidget *, const char *debugName) const override;
 
     QIcon iconForButtonType(TitleBarButtonType type, qreal dpr) const override;
@@ -16,6 +16,8 @@
 #include "qtquick/Platform.h"
 #include "View.h"
 
+#include <kdbindings/signal.h>
+
 #include <QQmlContext>
 #include <QQmlEngine>
 #include <QQuickItem>
@@ -70,14 +72,21 @@ static QString iconName(DropLocation loc, bool active)
 }
 }
 
+class ClassicDropIndicatorOverlay::Private
+{
+public:
+    KDBindings::ScopedConnection hoveredGroupRectConnection;
+    KDBindings::ScopedConnection currentDropLocationConnection;
+};
+
 ClassicDropIndicatorOverlay::ClassicDropIndicatorOverlay(Core::ClassicDropIndicatorOverlay *classicIndicators, Core::View *parent)
     : QObject(QtQuick::asView_qtquick(parent))
     , m_classicIndicators(classicIndicators)
+    , d(new Private())
     , m_window(isWayland() ? nullptr : new IndicatorWindow())
 {
     Q_ASSERT(parent);
-    classicIndicators->dptr()->hoveredGroupRectChanged.connect([this] { hoveredGroupRectChanged(); });
-    classicIndicators->dptr()->currentDropLocationChanged.connect([this] { currentDropLocationChanged(); });
+    connectToClassicIndicators();
 
     if (isWayland()) {
         auto subContext = new QQmlContext(plat()->qmlEngine()->rootContext(), this);
@@ -96,6 +105,32 @@ ClassicDropIndicatorOverlay::~ClassicDropIndicatorOverlay()
 {
     delete m_window;
     delete m_overlayItem;
+    delete d;
+}
+
+void ClassicDropIndicatorOverlay::connectToClassicIndicators()
+{
+    d->hoveredGroupRectConnection = m_classicIndicators->dptr()->hoveredGroupRectChanged.connect([this] { hoveredGroupRectChanged(); });
+    d->currentDropLocationConnection = m_classicIndicators->dptr()->currentDropLocationChanged.connect([this] { currentDropLocationChanged(); });
+}
+
+bool ClassicDropIndicatorOverlay::setClassicIndicators(Core::ClassicDropIndicatorOverlay *classicIndicators)
+{
+    // On Wayland the overlay is an item inside the drop area, it can't move to another one
+    if (!m_window)
+        return false;
+
+    // Not owned by the drop area anymore, the shared window outlives it
+    setParent(nullptr);
+
+    m_classicIndicators = classicIndicators;
+    connectToClassicIndicators();
+
+    Q_EMIT hoveredGroupRectChanged();
+    Q_EMIT currentDropLocationChanged();
+    Q_EMIT indicatorsVisibleChanged();
+
+    return true;
 }
 
 QString ClassicDropIndicatorOverlay::iconName(int loc, bool active) const
@@ -164,6 +199,12 @@ DropLocation ClassicDropIndicatorOverlay::hover(QPoint pt)
     return item ? locationForIndicator(item) : DropLocation_None;
 }
 
+DropLocation ClassicDropIndicatorOverlay::dropLocationAt(QPoint pt) const
+{
+    QQuickItem *item = indicatorForPos(pt);
+    return item ? locationForIndicator(item) : DropLocation_None;
+}
+
 void ClassicDropIndicatorOverlay::updateIndicatorVisibility()
 {
     Q_EMIT indicatorsVisibleChanged();
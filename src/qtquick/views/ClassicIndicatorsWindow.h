@@ -81,6 +81,7 @@ public:
     DropLocation currentDropLocation() const;
 
     DropLocation hover(QPoint globalPos) override;
+    DropLocation dropLocationAt(QPoint globalPos) const override;
     void updatePositions() override;
     QPoint posForIndicator(DropLocation) const override;
     void raise() override;
@@ -90,6 +91,7 @@ public:
     void resize(QSize) override;
     void setObjectName(const QString &) override;
     void updateIndicatorVisibility() override;
+    bool setClassicIndicators(Core::ClassicDropIndicatorOverlay *) override;
 
     QQuickItem *indicatorForLocation(DropLocation loc) const;
 
@@ -99,7 +101,11 @@ Q_SIGNALS:
     void currentDropLocationChanged();
 
 private:
-    Core::ClassicDropIndicatorOverlay *const m_classicIndicators;
+    void connectToClassicIndicators();
+
+    Core::ClassicDropIndicatorOverlay *m_classicIndicators;
+    class Private;
+    Private *const d;
     DropLocation locationForIndicator(const QQuickItem *) const;
     QQuickItem *indicatorForPos(QPoint) const;
     QVector<QQuickItem *> indicatorItems() const;
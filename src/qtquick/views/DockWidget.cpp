@@ -22,6 +22,7 @@
 #include "qtquick/views/ViewWrapper_p.h"
 
 #include <Config.h>
+#include <QPointer>
 #include <QQuickItem>
 
 /**
@@ -95,6 +96,21 @@ void DockWidget::setGuestItem(const QString &qmlFilename, QQmlContext *context)
         setGuestItem(guest);
 }
 
+void DockWidget::setLazyGuestItem(const QString &qmlFilename, QQmlContext *context)
+{
+    QPointer<QQmlContext> contextGuard = context;
+    m_dockWidget->setLazyGuestView([this, qmlFilename, contextGuard]() -> std::shared_ptr<Core::View> {
+        QQuickItem *guest = createItem(d->m_qmlEngine, qmlFilename, contextGuard);
+        if (!guest)
+            return {};
+
+        auto wrapper = asQQuickWrapper(guest);
+        wrapper->setParent(this);
+        makeItemFillParent(guest);
+        return wrapper;
+    });
+}
+
 void DockWidget::setGuestItem(QQuickItem *item)
 {
     auto wrapper = asQQuickWrapper(item);
@@ -113,6 +129,9 @@ QQuickItem *DockWidget::guestItem() const
 
 bool DockWidget::event(QEvent *e)
 {
+    if (e->type() == QEvent::Show)
+        dockWidget()->createPendingGuestView();
+
     if (dockWidget()->d->m_isSettingCurrent)
         return View::event(e);
 
@@ -77,6 +77,10 @@ public:
     /// @param context An optional QQmlContext. This is passed to QQmlComponent::create().
     void setGuestItem(const QString &qmlFilename, QQmlContext *context = nullptr);
 
+    /// Like setGuestItem(), but the QML file is only loaded when the dock widget is first shown.
+    /// @sa Core::DockWidget::setLazyGuestView()
+    void setLazyGuestItem(const QString &qmlFilename, QQmlContext *context = nullptr);
+
     /// @reimp
     Q_INVOKABLE void setGuestItem(QQuickItem *);
 
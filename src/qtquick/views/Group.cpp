@@ -105,12 +105,15 @@ void Group::init()
         }
     });
 
-    QQmlComponent component(plat()->qmlEngine(), plat()->viewFactory()->groupFilename());
+    QQmlComponent *component =
+        plat()->qmlComponent(plat()->qmlEngine(), plat()->viewFactory()->groupFilename().toString());
+    if (!component)
+        return;
 
-    m_visualItem = static_cast<QQuickItem *>(component.create());
+    m_visualItem = static_cast<QQuickItem *>(component->create());
 
     if (!m_visualItem) {
-        qWarning() << Q_FUNC_INFO << "Failed to create item" << component.errorString();
+        qWarning() << Q_FUNC_INFO << "Failed to create item" << component->errorString();
         return;
     }
 
@@ -12,10 +12,11 @@
 #include "RubberBand.h"
 #include "Config.h"
 #include "qtquick/Platform.h"
+#include "qtquick/ViewFactory.h"
 
 #include <QQmlEngine>
-
-using namespace KDDockWidgets;
+#include <QQuickWindow>
+#include <QSGRectangleNode>
 
 using namespace KDDockWidgets;
 using namespace KDDockWidgets::QtQuick;
@@ -25,8 +26,56 @@ RubberBand::RubberBand(QQuickItem *parent)
 {
     setVisible(false);
     setZ(1000);
-    QQuickItem *visualItem = createItem(
-        plat()->qmlEngine(), QStringLiteral("qrc:/kddockwidgets/qtquick/views/qml/RubberBand.qml"));
-    visualItem->setParent(this);
-    visualItem->setParentItem(this);
+
+    const QString filename = plat()->viewFactory()->rubberBandFilename().toString();
+    if (filename.isEmpty()) {
+        m_isNative = true;
+        setFlag(QQuickItem::ItemHasContents);
+    } else {
+        QQuickItem *visualItem = createItem(plat()->qmlEngine(), filename);
+        visualItem->setParent(this);
+        visualItem->setParentItem(this);
+    }
+}
+
+QSGNode *RubberBand::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    if (!m_isNative) {
+        delete oldNode;
+        return nullptr;
+    }
+
+    // A translucent fill with a 1px opaque border. The first child is the fill, the other 4 are
+    // the border's edges.
+    QSGNode *node = oldNode;
+    if (!node) {
+        node = new QSGNode();
+        const QColor colors[] = { QColor(0x5c, 0xa1, 0xc5, 0x55), QColor(0x5c, 0xa1, 0xc5) };
+        for (int i = 0; i < 5; ++i) {
+            QSGRectangleNode *child = QQuickItem::window()->createRectangleNode();
+            child->setColor(colors[i == 0 ? 0 : 1]);
+            node->appendChildNode(child);
+        }
+    }
+
+    const QRectF r = boundingRect();
+    const QRectF rects[] = { r.adjusted(1, 1, -1, -1),
+                             QRectF(r.left(), r.top(), r.width(), 1),
+                             QRectF(r.left(), r.bottom() - 1, r.width(), 1),
+                             QRectF(r.left(), r.top() + 1, 1, r.height() - 2),
+                             QRectF(r.right() - 1, r.top() + 1, 1, r.height() - 2) };
+
+    int i = 0;
+    for (QSGNode *child = node->firstChild(); child; child = child->nextSibling())
+        static_cast<QSGRectangleNode *>(child)->setRect(rects[i++]);
+
+    return node;
+}
+
+void RubberBand::QQUICKITEMgeometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    View::QQUICKITEMgeometryChanged(newGeometry, oldGeometry);
+
+    if (m_isNative && newGeometry.size() != oldGeometry.size())
+        QQuickItem::update();
 }
@@ -24,6 +24,13 @@ class DOCKS_EXPORT RubberBand : public View
     Q_OBJECT
 public:
     explicit RubberBand(QQuickItem *parent);
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *, UpdatePaintNodeData *) override;
+    void QQUICKITEMgeometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
+private:
+    bool m_isNative = false;
 };
 
 }
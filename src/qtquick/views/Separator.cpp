@@ -17,7 +17,11 @@
 
 #include "qtquick/ViewFactory.h"
 #include "qtquick/Platform.h"
+#include "kddockwidgets/Qt5Qt6Compat_p.h"
 
+#include <QMouseEvent>
+#include <QQuickWindow>
+#include <QSGRectangleNode>
 #include <QTimer>
 
 using namespace KDDockWidgets;
@@ -31,7 +35,17 @@ Separator::Separator(Core::Separator *controller, QQuickItem *parent)
 
 void Separator::init()
 {
-    View::createItem(plat()->viewFactory()->separatorFilename().toString(), this);
+    const QString filename = plat()->viewFactory()->separatorFilename().toString();
+    if (filename.isEmpty()) {
+        // No QML item, bindings or MouseArea per separator. Each separator is a single
+        // scene-graph rectangle, which the renderer batches with the other separators.
+        m_isNative = true;
+        setFlag(QQuickItem::ItemHasContents);
+        setAcceptedMouseButtons(Qt::LeftButton);
+        connect(this, &Separator::isVerticalChanged, this, &Separator::updateCursor);
+    } else {
+        View::createItem(filename, this);
+    }
 
     // Only set on Separator::init(), so single-shot
     QTimer::singleShot(0, this, &Separator::isVerticalChanged);
@@ -42,6 +56,79 @@ bool Separator::isVertical() const
     return m_controller->isVertical();
 }
 
+bool Separator::isNative() const
+{
+    return m_isNative;
+}
+
+QColor Separator::color() const
+{
+    return m_color;
+}
+
+void Separator::setColor(const QColor &color)
+{
+    if (color == m_color)
+        return;
+
+    m_color = color;
+    QQuickItem::update();
+    Q_EMIT colorChanged();
+}
+
+void Separator::updateCursor()
+{
+    if (Core::View::d->freed())
+        return;
+
+    setCursor(isVertical() ? Qt::SizeVerCursor : Qt::SizeHorCursor);
+}
+
+QSGNode *Separator::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    if (!m_isNative) {
+        delete oldNode;
+        return nullptr;
+    }
+
+    auto node = static_cast<QSGRectangleNode *>(oldNode);
+    if (!node)
+        node = QQuickItem::window()->createRectangleNode();
+
+    node->setRect(boundingRect());
+    node->setColor(m_color);
+
+    return node;
+}
+
+void Separator::QQUICKITEMgeometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    View::QQUICKITEMgeometryChanged(newGeometry, oldGeometry);
+
+    if (m_isNative && newGeometry.size() != oldGeometry.size())
+        QQuickItem::update();
+}
+
+void Separator::mousePressEvent(QMouseEvent *)
+{
+    onMousePressed();
+}
+
+void Separator::mouseMoveEvent(QMouseEvent *ev)
+{
+    onMouseMoved(Qt5Qt6Compat::eventPos(ev));
+}
+
+void Separator::mouseReleaseEvent(QMouseEvent *)
+{
+    onMouseReleased();
+}
+
+void Separator::mouseDoubleClickEvent(QMouseEvent *)
+{
+    onMouseDoubleClicked();
+}
+
 void Separator::onMousePressed()
 {
     if (Core::View::d->freed())
@@ -16,6 +16,7 @@
 #include "View.h"
 #include "kddockwidgets/docks_export.h"
 
+#include <QColor>
 #include <QQuickItem>
 
 namespace KDDockWidgets::Core {
@@ -30,10 +31,19 @@ class DOCKS_EXPORT Separator : public QtQuick::View
 {
     Q_OBJECT
     Q_PROPERTY(bool isVertical READ isVertical NOTIFY isVerticalChanged)
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
 public:
     explicit Separator(Core::Separator *controller, QQuickItem *parent = nullptr);
     bool isVertical() const;
 
+    /// Returns whether this separator is rendered and hit-tested in C++
+    /// That's the case unless ViewFactory::separatorFilename() returns a QML file.
+    bool isNative() const;
+
+    /// The color native separators are filled with
+    QColor color() const;
+    void setColor(const QColor &);
+
 public:
     // Interface with QML:
     Q_INVOKABLE void onMousePressed();
@@ -43,11 +53,23 @@ public:
 Q_SIGNALS:
     // constant but it's only set after Separator::init
     void isVerticalChanged();
+    void colorChanged();
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *, UpdatePaintNodeData *) override;
+    void QQUICKITEMgeometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void mousePressEvent(QMouseEvent *) override;
+    void mouseMoveEvent(QMouseEvent *) override;
+    void mouseReleaseEvent(QMouseEvent *) override;
+    void mouseDoubleClickEvent(QMouseEvent *) override;
 
 private:
     void init() override final;
     QSize minSize() const override;
+    void updateCursor();
     Core::Separator *const m_controller;
+    QColor m_color = QColor(0xef, 0xf0, 0xf1);
+    bool m_isNative = false;
 };
 
 }
@@ -23,7 +23,6 @@
 #include <qpa/qplatformwindow.h>
 #include <QtGui/private/qhighdpiscaling_p.h>
 #include <QGuiApplication>
-#include <QFile>
 #include <QQmlContext>
 
 using namespace KDDockWidgets;
@@ -161,10 +160,13 @@ void View::setGeometry(QRect rect)
 
 QQuickItem *View::createItem(QQmlEngine *engine, const QString &filename, QQmlContext *context)
 {
-    QQmlComponent component(engine, filename);
-    QObject *obj = component.create(context);
+    QQmlComponent *component = plat()->qmlComponent(engine, filename);
+    if (!component)
+        return nullptr;
+
+    QObject *obj = component->create(context);
     if (!obj) {
-        qWarning() << Q_FUNC_INFO << component.errorString();
+        qWarning() << Q_FUNC_INFO << component->errorString();
         return nullptr;
     }
 
@@ -859,18 +861,6 @@ bool View::isFixedHeight() const
     return m_controller && m_controller->isFixedHeight();
 }
 
-namespace KDDockWidgets {
-inline QString cleanQRCFilename(const QString &filename)
-{
-    // QFile doesn't understand qrc:/ only :/
-
-    if (filename.startsWith(QStringLiteral("qrc:/")))
-        return filename.right(filename.size() - 3);
-
-    return filename;
-}
-}
-
 QQuickItem *View::createItem(const QString &filename, QQuickItem *parent, QQmlContext *ctx)
 {
     auto p = parent;
@@ -888,15 +878,13 @@ QQuickItem *View::createItem(const QString &filename, QQuickItem *parent, QQmlCo
         return nullptr;
     }
 
-    if (!QFile::exists(cleanQRCFilename(filename))) {
-        qWarning() << Q_FUNC_INFO << "File not found" << filename;
+    QQmlComponent *component = plat()->qmlComponent(engine, filename);
+    if (!component)
         return nullptr;
-    }
 
-    QQmlComponent component(engine, filename);
-    auto qquickitem = qobject_cast<QQuickItem *>(component.create(ctx));
+    auto qquickitem = qobject_cast<QQuickItem *>(component->create(ctx));
     if (!qquickitem) {
-        qWarning() << Q_FUNC_INFO << component.errorString();
+        qWarning() << Q_FUNC_INFO << component->errorString();
         return nullptr;
     }
 
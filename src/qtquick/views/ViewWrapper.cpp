@@ -462,9 +462,18 @@ std::shared_ptr<Core::View> ViewWrapper::create(QQuickItem *item)
     if (!item)
         return {};
 
+    // Reuse the cached wrapper, unless it was created before the item got its controller,
+    // for example while the view was still being constructed
+    if (auto cached = cachedWrapper(item)) {
+        if (!static_cast<ViewWrapper *>(cached.get())->ownsController()
+            || !controllerForItem(item))
+            return cached;
+    }
+
     auto wrapper = new ViewWrapper(item);
     auto sharedptr = std::shared_ptr<View>(wrapper);
     wrapper->d->m_thisWeakPtr = sharedptr;
+    cacheWrapper(item, sharedptr);
 
     return sharedptr;
 }
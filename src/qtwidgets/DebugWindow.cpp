@@ -20,6 +20,7 @@
 #include "DebugWindow.h"
 #include "core/DockRegistry.h"
 #include "LayoutSaver.h"
+#include "Config.h"
 #include "Qt5Qt6Compat_p.h"
 
 #include "kddockwidgets/core/MainWindow.h"
@@ -215,6 +216,19 @@ DebugWindow::DebugWindow(QWidget *parent)
         }
     });
 
+    button = new QPushButton(this);
+    button->setText(QStringLiteral("Dump layout statistics"));
+    layout->addWidget(button);
+    connect(button, &QPushButton::clicked, this, &DebugWindow::dumpLayoutStatistics);
+
+    button = new QPushButton(this);
+    button->setText(QStringLiteral("Reset layout statistics"));
+    layout->addWidget(button);
+    connect(button, &QPushButton::clicked, this, [] {
+        Config::self().setLayoutProfilingEnabled(true);
+        DockRegistry::self()->resetLayoutStatistics();
+    });
+
     button = new QPushButton(this);
     button->setText(QStringLiteral("Detach central widget"));
     layout->addWidget(button);
@@ -337,6 +351,39 @@ void DebugWindow::dumpDockWidgetInfo()
     }
 }
 
+void DebugWindow::dumpLayoutStatistics()
+{
+    if (!Config::self().layoutProfilingEnabled()) {
+        qDebug() << "Layout profiling is disabled. Press \"Reset layout statistics\" to enable it";
+        return;
+    }
+
+    static const char *const operationNames[] = { "insert", "remove", "resize", "separator move",
+                                                   "restore", "simplify" };
+    static_assert(std::size(operationNames) == size_t(LayoutOperation::Count), "Keep in sync with LayoutOperation");
+
+    const auto snapshots = DockRegistry::self()->layoutStatistics();
+    for (const DockRegistry::LayoutStatisticsSnapshot &snapshot : snapshots) {
+        const LayoutOperationStats total = snapshot.statistics.total();
+        qDebug().noquote() << (snapshot.isFloating ? "FloatingWindow" : "MainWindow") << snapshot.name
+                           << QStringLiteral("total: %1 ms").arg(total.wallTimeNs / 1e6);
+
+        for (int i = 0; i < int(LayoutOperation::Count); ++i) {
+            const LayoutOperationStats &stats = snapshot.statistics.operations[i];
+            if (stats.count == 0)
+                continue;
+
+            qDebug().noquote() << "   " << operationNames[i]
+                               << QStringLiteral("count=%1 time=%2ms items=%3 guestGeometries=%4 signals=%5")
+                                      .arg(stats.count)
+                                      .arg(stats.wallTimeNs / 1e6)
+                                      .arg(stats.itemsVisited)
+                                      .arg(stats.guestGeometryUpdates)
+                                      .arg(stats.signalEmissions);
+        }
+    }
+}
+
 void DebugWindow::mousePressEvent(QMouseEvent *event)
 {
     if (!m_isPickingWidget)
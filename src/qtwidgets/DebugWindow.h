@@ -46,6 +46,7 @@ private:
     void repaintWidgetRecursive(QWidget *);
 
     void dumpDockWidgetInfo();
+    void dumpLayoutStatistics();
     ObjectViewer m_objectViewer;
     QEventLoop *m_isPickingWidget = nullptr;
 
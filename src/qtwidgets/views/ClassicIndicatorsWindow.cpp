@@ -18,6 +18,7 @@
 #include "core/Utils_p.h"
 
 
+#include <QHash>
 #include <QPainter>
 
 #include <utility>
@@ -62,10 +63,10 @@ public:
     QString iconName(bool active) const;
     QString iconFileName(bool active) const;
 
-    QImage m_image;
-    QImage m_imageActive;
-    bool m_hovered = false;
     const DropLocation m_dropLocation;
+    const QString m_fileName;
+    const QString m_activeFileName;
+    bool m_hovered = false;
 };
 
 static QString iconName(DropLocation loc, bool active)
@@ -113,13 +114,28 @@ static QString iconName(DropLocation loc, bool active)
 }
 }
 
+/// Returns the decoded indicator image, scaled for @p dpr
+/// Shared by all indicator windows, so each image is only loaded once per device pixel ratio.
+static QImage indicatorImage(const QString &fileName, qreal dpr)
+{
+    static QHash<QPair<QString, qreal>, QImage> s_images;
+
+    const auto key = qMakePair(fileName, dpr);
+    auto it = s_images.constFind(key);
+    if (it == s_images.cend()) {
+        const int size = qRound(INDICATOR_WIDTH * dpr);
+        QImage image = QImage(fileName).scaled(size, size);
+        image.setDevicePixelRatio(dpr);
+        it = s_images.insert(key, image);
+    }
+
+    return *it;
+}
+
 void Indicator::paintEvent(QPaintEvent *)
 {
     QPainter p(this);
-    if (m_hovered)
-        p.drawImage(rect(), m_imageActive, rect());
-    else
-        p.drawImage(rect(), m_image, rect());
+    p.drawImage(rect(), indicatorImage(m_hovered ? m_activeFileName : m_fileName, devicePixelRatioF()));
 }
 
 void Indicator::setHovered(bool hovered)
@@ -223,10 +239,15 @@ void IndicatorWindow::updateMask()
     if (!KDDockWidgets::windowManagerHasTranslucency()) {
         for (Indicator *indicator : std::as_const(m_indicators)) {
             if (indicator->isVisible())
-                region = region.united(QRegion(indicator->geometry(), QRegion::Rectangle));
+                region += indicator->geometry();
         }
     }
 
+    // Setting the mask is expensive, and it rarely changes during a drag
+    if (region == m_mask)
+        return;
+
+    m_mask = region;
     setMask(region);
 }
 
@@ -267,6 +288,16 @@ DropLocation IndicatorWindow::hover(QPoint globalPos)
     return loc;
 }
 
+DropLocation IndicatorWindow::dropLocationAt(QPoint globalPos) const
+{
+    for (Indicator *indicator : std::as_const(m_indicators)) {
+        if (indicator->isVisible() && indicator->rect().contains(indicator->mapFromGlobal(globalPos)))
+            return indicator->m_dropLocation;
+    }
+
+    return DropLocation_None;
+}
+
 void IndicatorWindow::updatePositions()
 {
     QRect r = rect();
@@ -321,14 +352,24 @@ bool IndicatorWindow::isWindow() const
     return QWidget::isWindow();
 }
 
+bool IndicatorWindow::setClassicIndicators(Core::ClassicDropIndicatorOverlay *overlay)
+{
+    // Only a top-level can move between drop areas
+    if (!QWidget::isWindow())
+        return false;
+
+    classicIndicators = overlay;
+    return true;
+}
+
 Indicator::Indicator(IndicatorWindow *parent,
                      DropLocation location)
     : QWidget(parent)
     , m_dropLocation(location)
+    , m_fileName(iconFileName(/*active=*/false))
+    , m_activeFileName(iconFileName(/*active=*/true))
 {
-    m_image = QImage(iconFileName(/*active=*/false)).scaled(INDICATOR_WIDTH, INDICATOR_WIDTH);
-    m_imageActive = QImage(iconFileName(/*active=*/true)).scaled(INDICATOR_WIDTH, INDICATOR_WIDTH);
-    setFixedSize(m_image.size());
+    setFixedSize(indicatorImage(m_fileName, 1).size());
     setVisible(true);
 }
 
@@ -36,6 +36,7 @@ public:
     explicit IndicatorWindow(Core::ClassicDropIndicatorOverlay *classicIndicators);
 
     DropLocation hover(QPoint globalPos) override;
+    DropLocation dropLocationAt(QPoint globalPos) const override;
     void updatePositions() override;
     QPoint posForIndicator(DropLocation) const override;
     void raise() override;
@@ -45,6 +46,7 @@ public:
     void resize(QSize) override;
     void setObjectName(const QString &) override;
     void updateIndicatorVisibility() override;
+    bool setClassicIndicators(Core::ClassicDropIndicatorOverlay *) override;
 
 private:
     void resizeEvent(QResizeEvent *ev) override;
@@ -55,7 +57,7 @@ private:
 
     Indicator *indicatorForLocation(DropLocation loc) const;
 
-    Core::ClassicDropIndicatorOverlay *const classicIndicators;
+    Core::ClassicDropIndicatorOverlay *classicIndicators;
     Indicator *const m_center;
     Indicator *const m_left;
     Indicator *const m_right;
@@ -66,6 +68,7 @@ private:
     Indicator *const m_outterBottom;
     Indicator *const m_outterTop;
     QVector<Indicator *> m_indicators;
+    QRegion m_mask;
 };
 
 }
@@ -107,10 +107,21 @@ void DockWidget::setWidget(QWidget *widget)
     m_dockWidget->setGuestView(ViewWrapper::create(widget));
 }
 
+void DockWidget::setLazyWidget(const std::function<QWidget *()> &factory)
+{
+    m_dockWidget->setLazyGuestView([factory]() -> std::shared_ptr<Core::View> {
+        if (QWidget *widget = factory())
+            return ViewWrapper::create(widget);
+        return {};
+    });
+}
+
 bool DockWidget::event(QEvent *e)
 {
-    if (e->type() == QEvent::Show)
+    if (e->type() == QEvent::Show) {
+        m_dockWidget->createPendingGuestView();
         m_dockWidget->open();
+    }
 
     // NOLINTNEXTLINE(bugprone-parent-virtual-call)
     return QtWidgets::View<QWidget>::event(e);
@@ -75,6 +75,12 @@ public:
      */
     void setWidget(QWidget *widget);
 
+#ifndef PYTHON_BINDINGS
+    /// Like setWidget(), but @p factory is only called when the dock widget is first shown.
+    /// @sa Core::DockWidget::setLazyGuestView()
+    void setLazyWidget(const std::function<QWidget *()> &factory);
+#endif
+
     /// @brief Returns the guest widget
     QWidget *widget() const;
 
@@ -21,7 +21,9 @@
 #include "core/DockRegistry_p.h"
 
 #include "qtwidgets/ViewFactory.h"
+#include "kddockwidgets/Qt5Qt6Compat_p.h"
 
+#include <QHash>
 #include <QPainter>
 #include <QStyle>
 #include <QStyleOptionDockWidget>
@@ -37,9 +39,62 @@ Button::~Button()
 {
 }
 
+namespace {
+
+/// Identifies a rendered title bar button. The icon tells the button type apart.
+struct ButtonPixmapKey
+{
+    qint64 iconKey = 0;
+    int state = 0;
+    QSize size;
+    qreal dpr = 1;
+    int logicalDpi = 0;
+    const QStyle *style = nullptr;
+    qint64 paletteKey = 0;
+
+    bool operator==(const ButtonPixmapKey &other) const
+    {
+        return iconKey == other.iconKey && state == other.state && size == other.size
+            && dpr == other.dpr && logicalDpi == other.logicalDpi && style == other.style
+            && paletteKey == other.paletteKey;
+    }
+};
+
+inline Qt5Qt6Compat::qhashtype qHash(const ButtonPixmapKey &key, Qt5Qt6Compat::qhashtype seed = 0)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    return qHashMulti(seed, key.iconKey, key.state, key.size.width(), key.size.height(), key.dpr,
+                      key.logicalDpi, quintptr(key.style), key.paletteKey);
+#else
+    // No qHashMulti() in Qt 5
+    QtPrivate::QHashCombine hash;
+    seed = hash(seed, key.iconKey);
+    seed = hash(seed, key.state);
+    seed = hash(seed, key.size.width());
+    seed = hash(seed, key.size.height());
+    seed = hash(seed, key.dpr);
+    seed = hash(seed, key.logicalDpi);
+    seed = hash(seed, quintptr(key.style));
+    return hash(seed, key.paletteKey);
+#endif
+}
+
+/// Rendered buttons, shared by all title bars.
+/// Title bars repaint a lot while dragging and when focus changes, but there's only a handful of
+/// distinct button states, so repaints become a blit.
+QHash<ButtonPixmapKey, QPixmap> &buttonPixmapCache()
+{
+    static QHash<ButtonPixmapKey, QPixmap> s_cache;
+    return s_cache;
+}
+
+// Plenty for 5 button types in a few states, over a couple of screens
+constexpr int MaxCachedButtonPixmaps = 256;
+
+}
+
 void Button::paintEvent(QPaintEvent *)
 {
-    QPainter p(this);
     QStyleOptionToolButton opt;
     opt.initFrom(this);
 
@@ -49,13 +104,49 @@ void Button::paintEvent(QPaintEvent *)
         } else {
             opt.state |= QStyle::State_Raised;
         }
-        style()->drawPrimitive(QStyle::PE_PanelButtonTool, &opt, &p, this);
     }
 
     opt.subControls = QStyle::SC_None;
     opt.features = QStyleOptionToolButton::None;
     opt.icon = icon();
 
+    QPainter p(this);
+
+    // Style sheets can style each button differently, so they can't share a pixmap
+    if (testAttribute(Qt::WA_StyleSheet) || testAttribute(Qt::WA_StyleSheetTarget)) {
+        paintButton(opt, &p);
+        return;
+    }
+
+    const qreal dpr = devicePixelRatioF();
+    const ButtonPixmapKey key { opt.icon.cacheKey(), int(opt.state), size(),
+                                dpr, logicalDpiX(), style(), opt.palette.cacheKey() };
+
+    auto &cache = buttonPixmapCache();
+    auto it = cache.constFind(key);
+    if (it == cache.cend()) {
+        if (cache.size() >= MaxCachedButtonPixmaps)
+            cache.clear();
+
+        QPixmap pixmap(size() * dpr);
+        pixmap.setDevicePixelRatio(dpr);
+        pixmap.fill(Qt::transparent);
+        {
+            QPainter pixmapPainter(&pixmap);
+            paintButton(opt, &pixmapPainter);
+        }
+
+        it = cache.insert(key, pixmap);
+    }
+
+    p.drawPixmap(0, 0, *it);
+}
+
+void Button::paintButton(QStyleOptionToolButton &opt, QPainter *p)
+{
+    if (opt.state & (QStyle::State_Sunken | QStyle::State_Raised))
+        style()->drawPrimitive(QStyle::PE_PanelButtonTool, &opt, p, this);
+
     // The first icon size is for scaling 1x, and is what QStyle expects. QStyle will pick ones
     // with higher resolution automatically when needed.
     const QList<QSize> iconSizes = opt.icon.availableSizes();
@@ -89,7 +180,7 @@ void Button::paintEvent(QPaintEvent *)
 #endif
     }
 
-    style()->drawComplexControl(QStyle::CC_ToolButton, &opt, &p, this);
+    style()->drawComplexControl(QStyle::CC_ToolButton, &opt, p, this);
 }
 
 QSize Button::sizeHint() const
@@ -106,6 +197,15 @@ QSize Button::sizeHint() const
 bool Button::event(QEvent *ev)
 {
     switch (ev->type()) {
+    case QEvent::StyleChange:
+    case QEvent::PaletteChange:
+    case QEvent::ScreenChangeInternal:
+#if QT_VERSION >= QT_VERSION_CHECK(6, 6, 0)
+    case QEvent::DevicePixelRatioChange:
+#endif
+        // Old pixmaps would just sit unused in the cache, drop them
+        buttonPixmapCache().clear();
+        break;
     case QEvent::MouseButtonPress:
     case QEvent::MouseButtonRelease:
     case QEvent::MouseButtonDblClick:
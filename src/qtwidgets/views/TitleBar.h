@@ -22,6 +22,8 @@
 QT_BEGIN_NAMESPACE
 class QHBoxLayout;
 class QLabel;
+class QPainter;
+class QStyleOptionToolButton;
 QT_END_NAMESPACE
 
 
@@ -115,6 +117,7 @@ protected:
     bool event(QEvent *ev) override;
     QSize sizeHint() const override;
     void paintEvent(QPaintEvent *) override;
+    void paintButton(QStyleOptionToolButton &opt, QPainter *p);
 
     bool m_inEventHandler = false;
 };
@@ -116,9 +116,18 @@ std::shared_ptr<Core::View> ViewWrapper::create(QWidget *widget)
     if (!widget)
         return {};
 
+    // Reuse the cached wrapper, unless it was created before the widget got its controller,
+    // for example while the view was still being constructed
+    if (auto cached = cachedWrapper(widget)) {
+        if (!static_cast<ViewWrapper *>(cached.get())->ownsController()
+            || !controllerForWidget(widget))
+            return cached;
+    }
+
     auto wrapper = new ViewWrapper(widget);
     auto sharedptr = std::shared_ptr<View>(wrapper);
     wrapper->d->m_thisWeakPtr = sharedptr;
+    cacheWrapper(widget, sharedptr);
 
     return sharedptr;
 }
@@ -250,7 +259,7 @@ bool ViewWrapper::is(Core::ViewType t) const
 std::shared_ptr<Core::View> ViewWrapper::rootView() const
 {
     if (auto w = m_widget->window())
-        return std::shared_ptr<Core::View>(new ViewWrapper(w));
+        return create(w);
 
     return {};
 }
@@ -258,7 +267,7 @@ std::shared_ptr<Core::View> ViewWrapper::rootView() const
 std::shared_ptr<Core::View> ViewWrapper::parentView() const
 {
     if (auto p = m_widget->parentWidget())
-        return std::shared_ptr<Core::View>(new ViewWrapper(p));
+        return create(p);
 
     return {};
 }
@@ -266,7 +275,7 @@ std::shared_ptr<Core::View> ViewWrapper::parentView() const
 std::shared_ptr<Core::View> ViewWrapper::childViewAt(QPoint localPos) const
 {
     if (QWidget *child = m_widget->childAt(localPos))
-        return std::shared_ptr<Core::View>(new ViewWrapper(child));
+        return create(child);
 
     return {};
 }
@@ -74,6 +74,44 @@ KDDW_QCORO_TASK tst_setGuestView()
     KDDW_TEST_RETURN(true);
 }
 
+KDDW_QCORO_TASK tst_lazyGuestView()
+{
+    Tests::EnsureTopLevelsDeleted e;
+
+    auto dw = Config::self().viewFactory()->createDockWidget("dw1")->asDockWidgetController();
+    int numCalls = 0;
+    dw->setLazyGuestView([&numCalls] {
+        numCalls++;
+        return Platform::instance()->tests_createView({ true })->asWrapper();
+    });
+
+    CHECK(dw->hasPendingGuestView());
+    CHECK(!dw->guestView());
+    CHECK(dw->lazyGuestReport().isLazy);
+    CHECK(!dw->lazyGuestReport().created);
+    CHECK_EQ(numCalls, 0);
+
+    dw->open();
+    KDDW_CO_AWAIT Platform::instance()->tests_wait(500);
+
+    CHECK(!dw->hasPendingGuestView());
+    CHECK(dw->guestView());
+    CHECK(dw->guestView()->isVisible());
+    CHECK(dw->lazyGuestReport().created);
+    CHECK(dw->lazyGuestReport().numViews >= 1);
+    CHECK_EQ(numCalls, 1);
+
+    // Reopening doesn't create it again
+    dw->close();
+    dw->open();
+    KDDW_CO_AWAIT Platform::instance()->tests_wait(100);
+    CHECK_EQ(numCalls, 1);
+
+    delete dw;
+
+    KDDW_TEST_RETURN(true);
+}
+
 KDDW_QCORO_TASK tst_toggleAction()
 {
     Tests::EnsureTopLevelsDeleted e;
@@ -212,6 +250,7 @@ static const auto s_tests = std::vector<KDDWTest> {
     TEST(tst_dockWidgetCtor),
     TEST(tst_toggleAction),
     TEST(tst_setGuestView),
+    TEST(tst_lazyGuestView),
     TEST(tst_isOpen),
     TEST(tst_setAsCurrentTab),
     TEST(tst_dwCloseAndReopen),
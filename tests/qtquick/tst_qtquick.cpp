@@ -16,12 +16,16 @@
 
 #include "kddockwidgets/KDDockWidgets.h"
 #include "qtquick/Platform.h"
+#include "qtquick/ViewFactory.h"
 #include "qtquick/views/TitleBar.h"
 #include "qtquick/views/DockWidget.h"
 #include "qtquick/views/MainWindow.h"
+#include "qtquick/views/Separator.h"
 #include "core/MDILayout.h"
 #include "core/views/MainWindowViewInterface.h"
 #include "core/MainWindow.h"
+#include "core/DropArea.h"
+#include "core/Separator.h"
 #include "core/Window_p.h"
 #include "core/Platform.h"
 
@@ -33,6 +37,7 @@
 
 #include <QtTest/QTest>
 #include <QQmlApplicationEngine>
+#include <QQmlComponent>
 #include <QQmlContext>
 
 using namespace KDDockWidgets;
@@ -66,6 +71,8 @@ private Q_SLOTS:
     void tst_affinities();
 
     void tst_deleteDockWidget();
+    void tst_qmlComponentCache();
+    void tst_nativeSeparators();
 };
 
 
@@ -487,6 +494,48 @@ void TestQtQuick::tst_deleteDockWidget()
     QTest::qWait(1);
 }
 
+void TestQtQuick::tst_qmlComponentCache()
+{
+    EnsureTopLevelsDeleted e;
+    QQmlApplicationEngine engine(":/main465.qml"); // or any other main.qml
+
+    // Views of the same kind share the same compiled component
+    auto plat = KDDockWidgets::QtQuick::Platform::instance();
+    const QString filename = plat->viewFactory()->groupFilename().toString();
+    QQmlComponent *component = plat->qmlComponent(&engine, filename);
+    QVERIFY(component);
+    QVERIFY(!component->isLoading());
+    QCOMPARE(plat->qmlComponent(&engine, filename), component);
+}
+
+void TestQtQuick::tst_nativeSeparators()
+{
+    // Tests that the default separators don't instantiate any QML
+    EnsureTopLevelsDeleted e;
+    QQmlApplicationEngine engine(":/main2.qml");
+
+    const auto mainWindows = DockRegistry::self()->mainwindows();
+    MainWindow *m = mainWindows.first();
+    auto dock0 = createDockWidget(
+        "dock0", Platform::instance()->tests_createView({ true, {}, QSize(400, 400) }));
+    auto dock1 = createDockWidget(
+        "dock1", Platform::instance()->tests_createView({ true, {}, QSize(400, 400) }));
+    m->addDockWidget(dock0, Location_OnLeft);
+    m->addDockWidget(dock1, Location_OnRight);
+
+    const auto separators = m->multiSplitter()->separators();
+    QVERIFY(!separators.isEmpty());
+    for (auto separator : separators) {
+        auto view = static_cast<QtQuick::Separator *>(static_cast<Core::Separator *>(separator)->view());
+        QVERIFY(view->isNative());
+        QVERIFY(view->childItems().isEmpty());
+        QVERIFY(view->flags() & QQuickItem::ItemHasContents);
+    }
+
+    // 1 event loop for DelayedDelete. Avoids LSAN warnings.
+    QTest::qWait(1);
+}
+
 void TestQtQuick::tst_effectiveVisibilityBug()
 {
     // When saving layout state, we should not store QQuickItem::isVisible(), as that is not the real
@@ -34,6 +34,8 @@
 #include "core/Separator.h"
 #include "core/Group.h"
 #include "core/DockWidget.h"
+#include "core/DockWidget_p.h"
+#include "core/DockRegistry.h"
 #include "core/MainWindow.h"
 #include "core/SideBar.h"
 
@@ -187,6 +189,8 @@ private Q_SLOTS:
     void tst_floatRemovesFromSideBar();
     void tst_overlayedGeometryIsSaved();
     void tst_overlayCrash();
+    void tst_overlayGroupIsReused();
+    void tst_overlayGroupLifetime();
     void tst_setAsCurrentTab();
     void tst_crash326();
     void tst_restoreWithIncompleteFactory();
@@ -236,6 +240,7 @@ private Q_SLOTS:
     void tst_complex();
     void tst_restoreFloatingMaximizedState();
     void tst_findAncestor();
+    void tst_viewWrapperCache();
 };
 
 void TestQtWidgets::tst_designerMainWindow()
@@ -1354,6 +1359,113 @@ void TestQtWidgets::tst_overlayCrash()
     pressOn(tb->mapToGlobal(QPoint(5, 5)), tb->view());
 }
 
+void TestQtWidgets::tst_overlayGroupIsReused()
+{
+    // Toggling between auto-hidden dock widgets re-targets the same overlay group
+    EnsureTopLevelsDeleted e;
+    KDDockWidgets::Config::self().setFlags(KDDockWidgets::Config::Flag_AutoHideSupport);
+
+    auto m1 = createMainWindow(QSize(1000, 1000), MainWindowOption_None, "MW1");
+    auto dw1 = newDockWidget(QStringLiteral("1"));
+    auto dw2 = newDockWidget(QStringLiteral("2"));
+    m1->addDockWidget(dw1, Location_OnLeft);
+    m1->addDockWidget(dw2, Location_OnLeft);
+    m1->moveToSideBar(dw1, SideBarLocation::West);
+    m1->moveToSideBar(dw2, SideBarLocation::West);
+
+    m1->toggleOverlayOnSideBar(dw1);
+    Core::Group *group = dw1->d->group();
+    QVERIFY(group);
+    QVERIFY(group->isOverlayed());
+    const QRect overlayGeometry = group->view()->geometry();
+
+    m1->toggleOverlayOnSideBar(dw2);
+    QVERIFY(!dw1->isOpen());
+    QVERIFY(dw2->isOverlayed());
+    QCOMPARE(dw2->d->group(), group);
+    QCOMPARE(group->dockWidgetCount(), 1);
+    QCOMPARE(group->view()->geometry(), overlayGeometry);
+
+    // Closing the overlay hides the group, it's kept for next time
+    m1->clearSideBarOverlay();
+    QVERIFY(!dw2->isOpen());
+    QVERIFY(!group->view()->isVisible());
+    QVERIFY(!group->beingDeletedLater());
+
+    m1->toggleOverlayOnSideBar(dw1);
+    QCOMPARE(dw1->d->group(), group);
+    QVERIFY(group->view()->isVisible());
+
+    // Floating the overlay takes the group out of the cache
+    dw1->setFloating(true);
+    QVERIFY(!group->isOverlayed());
+    m1->toggleOverlayOnSideBar(dw2);
+    QVERIFY(dw2->d->group() != group);
+}
+
+void TestQtWidgets::tst_overlayGroupLifetime()
+{
+    // A parked overlay group isn't a live group, and closing, floating or restoring a layout
+    // while overlayed doesn't leave it behind
+    EnsureTopLevelsDeleted e;
+    KDDockWidgets::Config::self().setFlags(KDDockWidgets::Config::Flag_AutoHideSupport);
+
+    auto m1 = createMainWindow(QSize(1000, 1000), MainWindowOption_None, "MW1");
+    auto dw1 = newDockWidget(QStringLiteral("1"));
+    auto dw2 = newDockWidget(QStringLiteral("2"));
+    auto dw3 = newDockWidget(QStringLiteral("3"));
+    m1->addDockWidget(dw1, Location_OnLeft);
+    m1->addDockWidget(dw2, Location_OnLeft);
+    m1->addDockWidget(dw3, Location_OnLeft);
+    m1->moveToSideBar(dw1, SideBarLocation::West);
+    m1->moveToSideBar(dw2, SideBarLocation::West);
+    const int numGroups = DockRegistry::self()->groups().size();
+
+    m1->toggleOverlayOnSideBar(dw1);
+    ObjectGuard<Core::Group> group = dw1->d->group();
+    QVERIFY(DockRegistry::self()->groups().contains(group));
+    QCOMPARE(DockRegistry::self()->groups().size(), numGroups + 1);
+
+    // Parked, it's not in the registry
+    m1->clearSideBarOverlay();
+    QVERIFY(group);
+    QVERIFY(!DockRegistry::self()->groups().contains(group));
+    QCOMPARE(DockRegistry::self()->groups().size(), numGroups);
+
+    // Restoring while parked doesn't mistake it for an empty group of the layout
+    LayoutSaver saver;
+    const QByteArray saved = saver.serializeLayout();
+    QVERIFY(saver.restoreLayout(saved));
+    QVERIFY(group);
+    m1->toggleOverlayOnSideBar(dw1);
+    QCOMPARE(dw1->d->group(), group.data());
+    QVERIFY(DockRegistry::self()->groups().contains(group));
+
+    // Restoring while overlayed closes the overlay, and its group goes away
+    QVERIFY(saver.restoreLayout(saved));
+    QVERIFY(!dw1->isOverlayed());
+    QVERIFY(Platform::instance()->tests_waitForDeleted(group));
+    QCOMPARE(DockRegistry::self()->groups().size(), numGroups);
+
+    // Closing the overlayed dock widget deletes its group too
+    m1->toggleOverlayOnSideBar(dw1);
+    group = dw1->d->group();
+    dw1->close();
+    QVERIFY(!dw1->isOpen());
+    QVERIFY(Platform::instance()->tests_waitForDeleted(group));
+    QCOMPARE(DockRegistry::self()->groups().size(), numGroups);
+
+    // Floating it keeps the group, which becomes a regular floating one
+    m1->toggleOverlayOnSideBar(dw2);
+    group = dw2->d->group();
+    dw2->setFloating(true);
+    QVERIFY(dw2->isFloating());
+    QVERIFY(group);
+    QVERIFY(!group->isOverlayed());
+    QVERIFY(DockRegistry::self()->groups().contains(group));
+    QCOMPARE(DockRegistry::self()->groups().size(), numGroups + 1);
+}
+
 void TestQtWidgets::tst_embeddedMainWindow()
 {
     EnsureTopLevelsDeleted e;
@@ -2138,6 +2250,35 @@ void TestQtWidgets::tst_findAncestor()
     QCOMPARE(mainWindow, KDDockWidgets::findAncestor<QMainWindow>(dockWidget));
 }
 
+void TestQtWidgets::tst_viewWrapperCache()
+{
+    auto parent = new QWidget();
+    auto child = new QWidget(parent);
+    const int numCachedBefore = QtCommon::ViewWrapper::numCachedWrappers();
+
+    // Wrapping the same widget twice, or walking up to it, reuses the wrapper
+    auto wrapper = QtWidgets::ViewWrapper::create(child);
+    QCOMPARE(QtWidgets::ViewWrapper::create(child).get(), wrapper.get());
+    auto parentWrapper = wrapper->parentView();
+    QCOMPARE(parentWrapper.get(), QtWidgets::ViewWrapper::create(parent).get());
+    QCOMPARE(QtCommon::ViewWrapper::numCachedWrappers(), numCachedBefore + 2);
+
+    // Repeated walks get the same wrapper, even if nobody held it in between
+    std::weak_ptr<Core::View> walked = wrapper->parentView();
+    parentWrapper.reset();
+    for (int i = 0; i < 3; ++i) {
+        QVERIFY(!walked.expired());
+        QCOMPARE(QtWidgets::ViewWrapper::create(child)->parentView().get(), walked.lock().get());
+    }
+    QCOMPARE(QtCommon::ViewWrapper::numCachedWrappers(), numCachedBefore + 2);
+
+    // Wrappers go away with their widgets
+    delete parent;
+    QCOMPARE(QtCommon::ViewWrapper::numCachedWrappers(), numCachedBefore);
+    QVERIFY(wrapper->isNull());
+    QVERIFY(walked.expired());
+}
+
 void TestQtWidgets::tst_standaloneTitleBar()
 {
     QWidget window;
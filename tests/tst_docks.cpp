@@ -25,7 +25,9 @@
 #include "core/WindowBeingDragged_p.h"
 #include "core/Logging_p.h"
 #include "core/layouting/Item_p.h"
+#include "core/layouting/ItemFreeContainer_p.h"
 #include "core/layouting/LayoutingGuest_p.h"
+#include "core/layouting/LayoutingHost_p.h"
 #include "core/layouting/LayoutingSeparator_p.h"
 #include "core/ViewFactory.h"
 #include "core/Action.h"
@@ -39,6 +41,8 @@
 #include "core/Stack.h"
 #include "core/SideBar.h"
 #include "core/Platform.h"
+#include "core/Platform_p.h"
+#include "core/indicators/ClassicDropIndicatorOverlay.h"
 
 #include <cstdlib>
 
@@ -1141,6 +1145,498 @@ KDDW_QCORO_TASK tst_doubleScheduleDelete()
     KDDW_TEST_RETURN(true);
 }
 
+KDDW_QCORO_TASK tst_floatingWindowPool()
+{
+    EnsureTopLevelsDeleted e;
+    Config::self().setFloatingWindowPoolSize(1);
+
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_None);
+    auto dock1 = createDockWidget("dock1");
+    auto fw1 = dock1->floatingWindow();
+    CHECK(fw1);
+
+    // Docking empties the floating window, which goes to the pool instead of being deleted
+    m->addDockWidget(dock1, Location_OnLeft);
+    CHECK(!dock1->isFloating());
+    CHECK(fw1->beingDeleted());
+    CHECK(!DockRegistry::self()->floatingWindows(/*includeBeingDeleted=*/true).contains(fw1));
+    CHECK(!fw1->isVisible());
+    CHECK(fw1->dropArea()->rootItem()->isEmpty());
+
+    KDDW_CO_AWAIT Platform::instance()->tests_wait(100);
+
+    // Floating again reuses it
+    dock1->setFloating(true);
+    CHECK(dock1->isFloating());
+    CHECK(dock1->floatingWindow() == fw1);
+    CHECK(!fw1->beingDeleted());
+    CHECK(fw1->isVisible());
+    CHECK(DockRegistry::self()->floatingWindows().contains(fw1));
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_floatingWindowZOrder()
+{
+    EnsureTopLevelsDeleted e;
+    auto dock1 = createDockWidget("dock1");
+    auto dock2 = createDockWidget("dock2");
+    auto fw1 = dock1->floatingWindow();
+    auto fw2 = dock2->floatingWindow();
+
+    dock2->raise();
+    auto floatingWindows = DockRegistry::self()->floatingWindows();
+    CHECK_EQ(floatingWindows.size(), 2);
+    CHECK_EQ(floatingWindows.last(), fw2);
+
+    dock1->raise();
+    floatingWindows = DockRegistry::self()->floatingWindows();
+    CHECK_EQ(floatingWindows.first(), fw2);
+    CHECK_EQ(floatingWindows.last(), fw1);
+
+    delete fw1;
+    CHECK_EQ(DockRegistry::self()->floatingWindows().size(), 1);
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_dragMotionCompression()
+{
+    EnsureTopLevelsDeleted e;
+    Config::self().setDragMotionCompression(true);
+    Config::self().setDragMotionCappedAtRefreshRate(true);
+    Config::self().setDragHoverThreshold(10);
+
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_None);
+    auto dock1 = createDockWidget("dock1");
+    auto dock2 = createDockWidget("dock2");
+    m->addDockWidget(dock1, Location_OnLeft);
+
+    // Compressed moves still end up dropping at the release position
+    auto fw = dock2->floatingWindow();
+    KDDW_CO_AWAIT dragFloatingWindowTo(fw, m->dropArea(), DropLocation_Right);
+    CHECK(!dock2->isFloating());
+    CHECK(dock2->isInMainWindow());
+    CHECK(m->dropArea()->checkSanity());
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_dragHoverThresholdCrossesSegments()
+{
+    // posForIndicator() only makes sense for the classic indicators
+    if (Core::ViewFactory::s_dropIndicatorType != DropIndicatorType::Classic)
+        KDDW_TEST_RETURN(true);
+
+    EnsureTopLevelsDeleted e;
+    // Bigger than the whole drag, so only the drop location comparison triggers a hover
+    Config::self().setDragHoverThreshold(10000);
+
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_None);
+    auto dock1 = createDockWidget("dock1");
+    auto dock2 = createDockWidget("dock2");
+    m->addDockWidget(dock1, Location_OnLeft);
+
+    KDDW_CO_AWAIT Platform::instance()->tests_wait(100);
+    auto draggable = draggableFor(dock2->floatingWindow()->view());
+    auto dropArea = m->dropArea();
+    Core::DropIndicatorOverlay *overlay = dropArea->dropIndicatorOverlay();
+
+    // Hover the group, then its left indicator
+    KDDW_CO_AWAIT drag(draggable, draggable->mapToGlobal(Point(10, 10)),
+                       m->view()->mapToGlobal(m->view()->rect().center()), ButtonAction_Press);
+    KDDW_CO_AWAIT drag(draggable, Point(), overlay->posForIndicator(DropLocation_Left), ButtonAction_None);
+    CHECK_EQ(overlay->currentDropLocation(), DropLocation_Left);
+
+    // Moving to the center indicator of the same group must not keep the stale location
+    const Point centerPos = overlay->posForIndicator(DropLocation_Center);
+    KDDW_CO_AWAIT drag(draggable, Point(), centerPos, ButtonAction_None);
+    CHECK_EQ(overlay->currentDropLocation(), DropLocation_Center);
+
+    KDDW_CO_AWAIT releaseOn(centerPos, draggable);
+    CHECK(dock2->isInMainWindow());
+    CHECK_EQ(dock1->dptr()->group(), dock2->dptr()->group());
+    CHECK(dropArea->checkSanity());
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_sharedClassicIndicatorWindow()
+{
+    // Only the Qt frontends support sharing it, and not on Wayland, where it's not a top-level
+    if (Core::ViewFactory::s_dropIndicatorType != DropIndicatorType::Classic
+        || !Platform::instance()->isQt() || isWayland())
+        KDDW_TEST_RETURN(true);
+
+    EnsureTopLevelsDeleted e;
+    Config::self().setSharedClassicIndicatorWindow(true);
+
+    auto m1 = createMainWindow(Size(800, 500), MainWindowOption_None, "m1");
+    auto m2 = createMainWindow(Size(800, 500), MainWindowOption_None, "m2");
+    auto overlay1 = static_cast<Core::ClassicDropIndicatorOverlay *>(m1->dropArea()->dropIndicatorOverlay());
+    auto overlay2 = static_cast<Core::ClassicDropIndicatorOverlay *>(m2->dropArea()->dropIndicatorOverlay());
+
+    // Nothing was hovered yet, so there's no window
+    CHECK(!overlay1->indicatorWindow());
+    CHECK(!overlay2->indicatorWindow());
+
+    auto dock1 = createDockWidget("dock1");
+    KDDW_CO_AWAIT dragFloatingWindowTo(dock1->floatingWindow(), m1->dropArea(), DropLocation_OutterLeft);
+    CHECK(dock1->isInMainWindow());
+    auto window = overlay1->indicatorWindow();
+    CHECK(window);
+
+    // Hovering the other main window hands the same window over
+    auto dock2 = createDockWidget("dock2");
+    KDDW_CO_AWAIT dragFloatingWindowTo(dock2->floatingWindow(), m2->dropArea(), DropLocation_OutterLeft);
+    CHECK(dock2->isInMainWindow());
+    CHECK(overlay2->indicatorWindow() == window);
+    CHECK(!overlay1->indicatorWindow());
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_layoutCounts()
+{
+    EnsureTopLevelsDeleted e;
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_None);
+    auto dropArea = m->dropArea();
+    auto dock1 = createDockWidget("dock1");
+    auto dock2 = createDockWidget("dock2");
+    auto dock3 = createDockWidget("dock3");
+
+    m->addDockWidget(dock1, Location_OnLeft);
+    m->addDockWidget(dock2, Location_OnRight);
+    dock1->addDockWidgetAsTab(dock3);
+    CHECK_EQ(dropArea->groupCount(), 2);
+    CHECK_EQ(dropArea->visibleGroupCount(), 2);
+    CHECK_EQ(dropArea->dockWidgetCount(), 3);
+    CHECK_EQ(dropArea->count(), 2);
+
+    int visited = 0;
+    dropArea->visitDockWidgets([&visited](Core::DockWidget *) {
+        ++visited;
+        return visited < 2;
+    });
+    CHECK_EQ(visited, 2);
+
+    // Closing leaves a placeholder behind, which the cached counts must notice
+    dock2->close();
+    CHECK_EQ(dropArea->count(), 2);
+    CHECK_EQ(dropArea->visibleCount(), 1);
+    CHECK_EQ(dropArea->groupCount(), 1);
+    CHECK_EQ(dropArea->dockWidgetCount(), 2);
+
+    dock2->show();
+    CHECK_EQ(dropArea->visibleCount(), 2);
+    CHECK_EQ(dropArea->groupCount(), 2);
+    CHECK_EQ(dropArea->groups().size(), dropArea->groupCount());
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_separatorPool()
+{
+    EnsureTopLevelsDeleted e;
+    Config::self().setSeparatorPoolSize(1);
+
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_None);
+    auto dock1 = createDockWidget("dock1");
+    auto dock2 = createDockWidget("dock2");
+    Core::LayoutingHost *host = m->multiSplitter()->asLayoutingHost();
+
+    m->addDockWidget(dock1, Location_OnLeft);
+    m->addDockWidget(dock2, Location_OnRight);
+    CHECK_EQ(m->multiSplitter()->separators().size(), 1);
+    CHECK_EQ(host->separatorPoolStats().created, 1);
+    auto separator = m->multiSplitter()->separators().at(0);
+
+    // Closing leaves a single visible item, the separator goes to the pool instead of being deleted
+    dock2->close();
+    CHECK_EQ(m->multiSplitter()->separators().size(), 0);
+    CHECK_EQ(host->separatorPoolStats().pooled, 1);
+    CHECK_EQ(host->separatorPoolStats().recycled, 1);
+    CHECK_EQ(Core::Separator::numSeparators(), 1);
+
+    // Showing it again reuses the pooled separator
+    dock2->open();
+    CHECK_EQ(m->multiSplitter()->separators().size(), 1);
+    CHECK(m->multiSplitter()->separators().at(0) == separator);
+    CHECK_EQ(host->separatorPoolStats().reused, 1);
+    CHECK_EQ(host->separatorPoolStats().created, 1);
+    CHECK_EQ(host->separatorPoolStats().pooled, 0);
+    CHECK(separator->parentContainer() == m->multiSplitter()->rootItem());
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_layoutTransitions()
+{
+    EnsureTopLevelsDeleted e;
+    Config::self().setLayoutTransitionDuration(200);
+
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_None);
+    auto dock1 = createDockWidget("dock1");
+    auto dock2 = createDockWidget("dock2");
+    Core::LayoutingHost *host = m->multiSplitter()->asLayoutingHost();
+
+    m->addDockWidget(dock1, Location_OnLeft);
+    Core::Group *group1 = dock1->dptr()->group();
+    const Rect initialGeometry = group1->geometry();
+
+    // The new group snaps into place, while the existing one animates towards its new size
+    m->addDockWidget(dock2, Location_OnRight);
+    Core::Group *group2 = dock2->dptr()->group();
+    CHECK(host->isInTransition(group1->asLayoutingGuest()));
+    CHECK(!host->isInTransition(group2->asLayoutingGuest()));
+    CHECK_EQ(group1->geometry(), initialGeometry);
+    CHECK_EQ(group2->geometry(), group2->layoutItem()->mapToRoot(group2->layoutItem()->rect()));
+    CHECK(m->multiSplitter()->checkSanity());
+
+    KDDW_CO_AWAIT Platform::instance()->tests_wait(500);
+    CHECK(!host->hasTransitions());
+    CHECK_EQ(group1->geometry(), group1->layoutItem()->mapToRoot(group1->layoutItem()->rect()));
+    CHECK(group1->width() < initialGeometry.width());
+
+    // Closing mid-transition retargets it, ending where it started
+    dock2->close();
+    CHECK(host->isInTransition(group1->asLayoutingGuest()));
+    dock2->open();
+    dock2->close();
+    KDDW_CO_AWAIT Platform::instance()->tests_wait(500);
+    CHECK(!host->hasTransitions());
+    CHECK_EQ(group1->geometry(), initialGeometry);
+    CHECK(m->multiSplitter()->checkSanity());
+
+    // Saving the layout doesn't save mid-animation geometries
+    dock2->open();
+    CHECK(host->isInTransition(group1->asLayoutingGuest()));
+    LayoutSaver saver;
+    saver.serializeLayout();
+    CHECK(!host->hasTransitions());
+    CHECK_EQ(group1->geometry(), group1->layoutItem()->mapToRoot(group1->layoutItem()->rect()));
+    dock2->close();
+    KDDW_CO_AWAIT Platform::instance()->tests_wait(500);
+
+    // Transitions can be disabled, guests then move immediately
+    Config::self().setLayoutTransitionDuration(0);
+    dock2->open();
+    CHECK(!host->hasTransitions());
+    CHECK_EQ(group1->geometry(), group1->layoutItem()->mapToRoot(group1->layoutItem()->rect()));
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_layoutStatistics()
+{
+    EnsureTopLevelsDeleted e;
+    Config::self().setLayoutProfilingEnabled(true);
+
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_None, "MainWindow1");
+    auto dock1 = createDockWidget("dock1");
+    auto dock2 = createDockWidget("dock2");
+    Core::Layout *layout = m->multiSplitter();
+    layout->resetStatistics();
+
+    m->addDockWidget(dock1, Location_OnLeft);
+    m->addDockWidget(dock2, Location_OnRight);
+
+    LayoutStatistics stats = layout->statistics();
+    CHECK_EQ(stats[LayoutOperation::Insert].count, 2);
+    CHECK(stats[LayoutOperation::Insert].itemsVisited > 0);
+    CHECK(stats[LayoutOperation::Insert].guestGeometryUpdates > 0);
+    CHECK(stats[LayoutOperation::Insert].signalEmissions > 0);
+    CHECK_EQ(stats[LayoutOperation::SeparatorMove].count, 0);
+
+    // Each operation is accounted to its own kind
+    dock2->close();
+    stats = layout->statistics();
+    CHECK_EQ(stats[LayoutOperation::Insert].count, 2);
+    CHECK(stats[LayoutOperation::Remove].count > 0);
+
+    // DockRegistry returns a snapshot per layout
+    const auto snapshots = DockRegistry::self()->layoutStatistics();
+    CHECK_EQ(snapshots.size(), 1);
+    CHECK_EQ(snapshots.constFirst().name, QString("MainWindow1"));
+    CHECK(!snapshots.constFirst().isFloating);
+    CHECK_EQ(snapshots.constFirst().statistics[LayoutOperation::Remove].count, stats[LayoutOperation::Remove].count);
+
+    DockRegistry::self()->resetLayoutStatistics();
+    CHECK_EQ(layout->statistics().total().count, 0);
+
+    // A scope nested in one of the same kind counts once, even with another kind in between
+    {
+        Core::LayoutProfilingScope resize(layout->asLayoutingHost(), LayoutOperation::Resize);
+        Core::LayoutProfilingScope simplify(layout->asLayoutingHost(), LayoutOperation::Simplify);
+        Core::LayoutProfilingScope nestedResize(layout->asLayoutingHost(), LayoutOperation::Resize);
+    }
+    stats = layout->statistics();
+    CHECK_EQ(stats[LayoutOperation::Resize].count, 1);
+    CHECK_EQ(stats[LayoutOperation::Simplify].count, 1);
+
+    // Nothing is recorded while disabled
+    Config::self().setLayoutProfilingEnabled(false);
+    dock2->open();
+    CHECK_EQ(layout->statistics().total().count, 0);
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_deletionService()
+{
+    // Otherwise controllers use QObject::deleteLater()
+    if (!usesQTBUG83030Workaround())
+        KDDW_TEST_RETURN(true);
+
+    EnsureTopLevelsDeleted e;
+    Core::DeletionService &service = Platform::instance()->d->m_deletionService;
+
+    auto dock1 = createDockWidget("dock1");
+    auto dock2 = createDockWidget("dock2");
+    auto dock3 = createDockWidget("dock3");
+    CHECK_EQ(DockRegistry::self()->floatingWindows().size(), 3);
+
+    // Closing them schedules their floating windows, which are deleted together
+    const auto floatingWindows = DockRegistry::self()->floatingWindows();
+    for (auto fw : floatingWindows)
+        fw->view()->close();
+
+    CHECK_EQ(service.numPending(), 3);
+    for (auto fw : floatingWindows)
+        CHECK(service.isScheduled(fw));
+
+    // Scheduling twice does nothing
+    floatingWindows.constFirst()->destroyLater();
+    CHECK_EQ(service.numPending(), 3);
+
+    KDDW_CO_AWAIT Platform::instance()->tests_wait(100);
+    CHECK_EQ(service.numPending(), 0);
+    CHECK(DockRegistry::self()->floatingWindows().isEmpty());
+
+    delete dock1;
+    delete dock2;
+    delete dock3;
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_registryNameIndex()
+{
+    EnsureTopLevelsDeleted e;
+    auto dr = DockRegistry::self();
+
+    auto dock1 = createDockWidget("dock1", Platform::instance()->tests_createView({ true }), {}, {}, /*show=*/false);
+    auto dock2 = createDockWidget("dock2", Platform::instance()->tests_createView({ true }), {}, {}, /*show=*/false);
+    CHECK(dr->isSane());
+    CHECK_EQ(dr->dockByName("dock2"), dock2);
+
+    // Renaming keeps the lookup up to date
+    dock2->setUniqueName("dock3");
+    CHECK_EQ(dr->dockByName("dock3"), dock2);
+    CHECK(!dr->dockByName("dock2"));
+
+    {
+        // A duplicate name makes the registry insane until it's gone
+        SetExpectedWarning sew("already exists");
+        auto duplicate = createDockWidget("dock1", Platform::instance()->tests_createView({ true }), {}, {}, /*show=*/false);
+        CHECK(!dr->isSane());
+        CHECK_EQ(dr->dockByName("dock1"), dock1);
+        delete duplicate;
+        CHECK(dr->isSane());
+    }
+
+    delete dock1;
+    delete dock2;
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_affinitySet()
+{
+    EnsureTopLevelsDeleted e;
+    auto dr = DockRegistry::self();
+
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_None, "MainWindow1");
+    m->setAffinities({ "a1", "a2" });
+
+    const AffinitySet a1 = dr->internAffinities({ "a1" });
+    const AffinitySet a3 = dr->internAffinities({ "a3" });
+    CHECK(dr->affinitiesMatch(m->affinitySet(), a1));
+    CHECK(!dr->affinitiesMatch(m->affinitySet(), a3));
+    CHECK(!dr->affinitiesMatch(m->affinitySet(), AffinitySet()));
+    CHECK(dr->affinitiesMatch(AffinitySet(), AffinitySet()));
+
+    // Past 63 distinct names the bits are shared, but matching stays exact
+    Vector<AffinitySet> sets;
+    for (int i = 0; i < 70; ++i)
+        sets.push_back(dr->internAffinities({ QString("overflow-") + QString::number(i) }));
+
+    CHECK(dr->affinitiesMatch(sets.last(), dr->internAffinities({ "overflow-69" })));
+    CHECK(!dr->affinitiesMatch(sets.last(), sets[sets.size() - 2]));
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_serializeSnapshot()
+{
+    EnsureTopLevelsDeleted e;
+
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_None, "MainWindow1");
+    auto dock1 = createDockWidget("dock1");
+    auto dock2 = createDockWidget("dock2");
+    auto dock3 = createDockWidget("dock3");
+    m->addDockWidget(dock1, Location_OnLeft);
+    dock1->addDockWidgetAsTab(dock2);
+    dock3->close();
+
+    LayoutSaver saver;
+    const QByteArray snapshot = saver.serializeSnapshot();
+    const auto data = reinterpret_cast<const int32_t *>(snapshot.constData());
+
+    CHECK_EQ(data[0], 0x4B444453);
+    CHECK_EQ(data[1], LayoutSaver::snapshotVersion());
+    const int numNodes = data[2];
+    const int stringTableSize = data[3];
+    CHECK_EQ(numNodes, 5); // main window, group, 3 docks
+    CHECK_EQ(int(snapshot.size()), int((4 + numNodes * 12) * sizeof(int32_t)) + stringTableSize);
+
+    const char *strings = snapshot.constData() + (4 + numNodes * 12) * sizeof(int32_t);
+    auto nodeName = [data, strings](int node) {
+        const int32_t *record = data + 4 + node * 12;
+        return std::string(strings + record[8], record[9]);
+    };
+
+    auto record = [data](int node) {
+        return data + 4 + node * 12;
+    };
+
+    CHECK_EQ(record(0)[0], int(LayoutSaver::SnapshotNodeKind::MainWindow));
+    CHECK_EQ(record(0)[1], -1);
+    CHECK_EQ(nodeName(0), std::string("MainWindow1"));
+
+    CHECK_EQ(record(1)[0], int(LayoutSaver::SnapshotNodeKind::Group));
+    CHECK_EQ(record(1)[1], 0);
+
+    CHECK_EQ(record(2)[0], int(LayoutSaver::SnapshotNodeKind::DockWidget));
+    CHECK_EQ(record(2)[1], 1);
+    CHECK_EQ(record(2)[7], 0);
+    CHECK_EQ(nodeName(2), std::string("dock1"));
+    CHECK(!(record(2)[6] & LayoutSaver::SnapshotNodeFlag_CurrentTab));
+
+    CHECK_EQ(record(3)[7], 1);
+    CHECK_EQ(nodeName(3), std::string("dock2"));
+    CHECK(record(3)[6] & LayoutSaver::SnapshotNodeFlag_CurrentTab);
+    CHECK(record(3)[6] & LayoutSaver::SnapshotNodeFlag_Visible);
+    CHECK_EQ(record(3)[4], dock2->view()->width());
+
+    // Closed dock widgets have no parent
+    CHECK_EQ(nodeName(4), std::string("dock3"));
+    CHECK_EQ(record(4)[1], -1);
+    CHECK(!(record(4)[6] & LayoutSaver::SnapshotNodeFlag_Visible));
+
+    KDDW_TEST_RETURN(true);
+}
+
 KDDW_QCORO_TASK tst_repeatedShowHide()
 {
     EnsureTopLevelsDeleted e;
@@ -5563,6 +6059,100 @@ KDDW_QCORO_TASK tst_mdiZorder2()
     KDDW_TEST_RETURN(true);
 }
 
+KDDW_QCORO_TASK tst_mdiIndexes()
+{
+    // Tests that the MDI layout's guest hash, z-order and spatial index follow moves, raises and removals
+    EnsureTopLevelsDeleted e;
+
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_MDI);
+    auto layout = m->layout()->asMDILayout();
+    auto root = static_cast<Core::ItemFreeContainer *>(layout->rootItem());
+
+    auto dock0 = createDockWidget(
+        "dock0", Platform::instance()->tests_createView({ true, {}, Size(200, 200) }));
+    auto dock1 = createDockWidget(
+        "dock1", Platform::instance()->tests_createView({ true, {}, Size(200, 200) }));
+    auto dock2 = createDockWidget(
+        "dock2", Platform::instance()->tests_createView({ true, {}, Size(200, 200) }));
+
+    layout->addDockWidget(dock0, Point(0, 0), {});
+    layout->addDockWidget(dock1, Point(100, 100), {});
+    layout->addDockWidget(dock2, Point(500, 0), {});
+
+    Core::Item *item0 = layout->itemForGroup(dock0->d->group());
+    Core::Item *item1 = layout->itemForGroup(dock1->d->group());
+    Core::Item *item2 = layout->itemForGroup(dock2->d->group());
+    CHECK(item0);
+    CHECK(item1);
+    CHECK(item2);
+
+    // Most recently added is on top
+    CHECK_EQ(root->itemAt(Point(150, 150)), item1);
+    CHECK_EQ(root->zOrderedItems().last(), item2);
+
+    layout->raiseDockWidget(dock0);
+    CHECK_EQ(root->itemAt(Point(150, 150)), item0);
+    CHECK_EQ(root->zOrderedItems().last(), item0);
+    CHECK_EQ(root->itemsIntersecting(Rect(150, 150, 10, 10)).size(), 2);
+
+    // Moving dock2 away from everything, then onto dock1
+    layout->moveDockWidget(dock2, Point(2000, 2000));
+    CHECK(root->itemsIntersecting(Rect(500, 0, 200, 200)).isEmpty());
+    CHECK_EQ(root->itemAt(Point(2050, 2050)), item2);
+
+    layout->moveDockWidget(dock2, Point(150, 150));
+    CHECK_EQ(root->itemAt(Point(280, 280)), item2);
+    CHECK_EQ(layout->itemForGroup(dock2->d->group()), item2);
+
+    Core::Group *group2 = dock2->d->group();
+    delete dock2;
+    CHECK(KDDW_CO_AWAIT Platform::instance()->tests_waitForDeleted(group2));
+    CHECK_EQ(root->itemAt(Point(280, 280)), item1);
+    CHECK_EQ(root->zOrderedItems().size(), 2);
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_mdiArrange()
+{
+    EnsureTopLevelsDeleted e;
+
+    auto m = createMainWindow(Size(800, 500), MainWindowOption_MDI);
+    auto layout = m->layout()->asMDILayout();
+
+    Vector<Core::DockWidget *> docks;
+    for (int i = 0; i < 5; ++i) {
+        auto dock = createDockWidget(
+            QString("dock-") + QString::number(i), Platform::instance()->tests_createView({ true, {}, Size(100, 100) }));
+        layout->addDockWidget(dock, layout->suggestedPosition(Size(150, 150)), {});
+        docks.push_back(dock);
+    }
+
+    auto geometryOf = [layout](Core::DockWidget *dw) {
+        return layout->itemForGroup(dw->d->group())->geometry();
+    };
+
+    layout->arrange(MDIArrangement::Tile);
+    const Rect area = layout->rootItem()->rect();
+    for (int i = 0; i < docks.size(); ++i) {
+        CHECK(area.contains(geometryOf(docks[i])));
+        for (int j = i + 1; j < docks.size(); ++j)
+            CHECK(!geometryOf(docks[i]).intersects(geometryOf(docks[j])));
+    }
+
+    layout->arrange(MDIArrangement::Cascade);
+    CHECK_EQ(geometryOf(docks[1]).topLeft() - geometryOf(docks[0]).topLeft(), Point(30, 30));
+
+    layout->arrange(MDIArrangement::Masonry);
+    for (int i = 0; i < docks.size(); ++i) {
+        CHECK(area.contains(geometryOf(docks[i])));
+        for (int j = i + 1; j < docks.size(); ++j)
+            CHECK(!geometryOf(docks[i]).intersects(geometryOf(docks[j])));
+    }
+
+    KDDW_TEST_RETURN(true);
+}
+
 KDDW_QCORO_TASK tst_mixedMDIRestoreToArea()
 {
     EnsureTopLevelsDeleted e;
@@ -6365,12 +6955,27 @@ static const auto s_tests = std::vector<KDDWTest>
         TEST(tst_mdiZorder),
         TEST(tst_mdiCrash),
         TEST(tst_mdiZorder2),
+        TEST(tst_mdiIndexes),
+        TEST(tst_mdiArrange),
         TEST(tst_mdiSetSize),
         TEST(tst_mixedMDIRestoreToArea),
         TEST(tst_redockToMDIRestoresPosition),
         TEST(tst_maximizeButton),
         TEST(tst_restoreAfterUnminimized),
         TEST(tst_doubleScheduleDelete),
+        TEST(tst_floatingWindowPool),
+        TEST(tst_separatorPool),
+        TEST(tst_layoutTransitions),
+        TEST(tst_layoutStatistics),
+        TEST(tst_deletionService),
+        TEST(tst_registryNameIndex),
+        TEST(tst_affinitySet),
+        TEST(tst_serializeSnapshot),
+        TEST(tst_floatingWindowZOrder),
+        TEST(tst_dragMotionCompression),
+        TEST(tst_dragHoverThresholdCrossesSegments),
+        TEST(tst_sharedClassicIndicatorWindow),
+        TEST(tst_layoutCounts),
         TEST(tst_minimizeRestoreBug),
 #endif
         TEST(tst_keepLast)
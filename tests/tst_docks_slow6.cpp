@@ -28,6 +28,7 @@
 #include "core/MainWindow.h"
 #include "core/DockWidget.h"
 #include "core/DockWidget_p.h"
+#include "core/Group_p.h"
 #include "core/Separator.h"
 #include "core/TabBar.h"
 #include "core/Stack.h"
@@ -112,10 +113,62 @@ KDDW_QCORO_TASK tst_isFocused()
     KDDW_CO_RETURN(true);
 }
 
+KDDW_QCORO_TASK tst_focusNotifiesOnlyChangedScopes()
+{
+    {
+        EnsureTopLevelsDeleted e;
+        auto m = createMainWindow(Size(800, 500), MainWindowOption_None);
+        auto dock1 = createDockWidget(QStringLiteral("dock1"),
+                                      Platform::instance()->tests_createFocusableView({ true }));
+        auto dock2 = createDockWidget(QStringLiteral("dock2"),
+                                      Platform::instance()->tests_createFocusableView({ true }));
+        auto dock3 = createDockWidget(QStringLiteral("dock3"),
+                                      Platform::instance()->tests_createFocusableView({ true }));
+        m->addDockWidget(dock1, Location_OnLeft);
+        m->addDockWidget(dock2, Location_OnLeft);
+        m->addDockWidget(dock3, Location_OnLeft);
+
+        auto group1 = dock1->dptr()->group();
+        auto group3 = dock3->dptr()->group();
+        const int numGroup1NotificationsBefore = group1->numFocusNotifications();
+
+        int numGroup3Changes = 0;
+        KDBindings::ScopedConnection con = group3->dptr()->isFocusedChanged.connect([&numGroup3Changes] {
+            numGroup3Changes++;
+        });
+
+        dock1->guestView()->setFocus(Qt::OtherFocusReason);
+        KDDW_CO_AWAIT Platform::instance()->tests_waitForEvent(dock1->guestView().get(), Event::FocusIn);
+        CHECK(dock1->isFocused());
+        CHECK(dock1->dptr()->group()->isFocused());
+
+        dock2->guestView()->setFocus(Qt::OtherFocusReason);
+        KDDW_CO_AWAIT Platform::instance()->tests_waitForEvent(dock2->guestView().get(), Event::FocusIn);
+        CHECK(!dock1->isFocused());
+        CHECK(!dock1->dptr()->group()->isFocused());
+        CHECK(dock2->isFocused());
+        CHECK(dock2->dptr()->group()->isFocused());
+
+        // group1 was told it gained and then lost focus
+        CHECK(group1->numFocusNotifications() > numGroup1NotificationsBefore);
+
+        // dock3's group never had focus, so it wasn't bothered at all. Broadcasting every focus
+        // change to every scope would have notified it, even if its isFocused() didn't change.
+        CHECK_EQ(group3->numFocusNotifications(), 0);
+        CHECK_EQ(numGroup3Changes, 0);
+        CHECK(!group3->isFocused());
+    }
+
+    KDDW_CO_AWAIT Platform::instance()->tests_wait(1000);
+
+    KDDW_CO_RETURN(true);
+}
+
 static const auto s_tests = std::vector<KDDWTest>
 {
 #if !defined(KDDW_FRONTEND_FLUTTER)
-    TEST(tst_isFocused)
+    TEST(tst_isFocused),
+    TEST(tst_focusNotifiesOnlyChangedScopes)
 #endif
 };
 
@@ -23,6 +23,7 @@
 
 #include <memory.h>
 #include <cstdlib>
+#include <unordered_map>
 #include <utility>
 
 using namespace KDDockWidgets;
@@ -2313,6 +2314,92 @@ KDDW_QCORO_TASK tst_relayoutIfNeeded()
     KDDW_TEST_RETURN(true);
 }
 
+KDDW_QCORO_TASK tst_simulateDrop()
+{
+    DeleteViews deleteViews;
+
+    auto root = createRoot();
+    Item *item1 = createItem();
+    Item *item2 = createItem();
+    root->insertItem(item1, Location_OnLeft);
+    root->insertItem(item2, Location_OnRight);
+
+    Item itemBeingDropped(nullptr);
+    itemBeingDropped.setSize(Size(200, 200));
+    itemBeingDropped.setMinSize(Size(100, 100));
+
+    const DropSimulation simulation = root->simulateDrop(&itemBeingDropped, item2, Location_OnBottom);
+    CHECK(simulation.isExact);
+    CHECK_EQ(simulation.dropRect, root->suggestedDropRect(&itemBeingDropped, item2, Location_OnBottom));
+
+    // Now drop for real, guests should only be resized once and match the simulation
+    Item *item3 = createItem(Size(100, 100));
+    auto guest1 = static_cast<Guest *>(item1->guest());
+    auto guest2 = static_cast<Guest *>(item2->guest());
+    auto guest3 = static_cast<Guest *>(item3->guest());
+    guest1->m_numSetGeometry = 0;
+    guest2->m_numSetGeometry = 0;
+    guest3->m_numSetGeometry = 0;
+
+    {
+        DeferredGuestGeometry deferredGeometry(root.get());
+        ItemBoxContainer::insertItemRelativeTo(item3, item2, Location_OnBottom, DefaultSizeMode::FairButFloor);
+        CHECK(item2->guestGeometryUpdatesSuspended());
+        CHECK_EQ(guest2->m_numSetGeometry, 0);
+    }
+
+    CHECK(!item2->guestGeometryUpdatesSuspended());
+    CHECK_EQ(guest1->m_numSetGeometry, 0);
+    CHECK_EQ(guest2->m_numSetGeometry, 1);
+    CHECK_EQ(guest3->m_numSetGeometry, 1);
+    CHECK_EQ(item3->mapToRoot(item3->rect()), simulation.dropRect);
+    CHECK(root->checkSanity());
+
+    KDDW_TEST_RETURN(true);
+}
+
+KDDW_QCORO_TASK tst_coalescedGeometryChanges()
+{
+    DeleteViews deleteViews;
+
+    auto root = createRoot();
+    Item *item1 = createItem();
+    Item *item2 = createItem();
+    Item *item3 = createItem();
+    root->insertItem(item1, Location_OnLeft);
+    root->insertItem(item2, Location_OnRight);
+    ItemBoxContainer::insertItemRelativeTo(item3, item2, Location_OnBottom);
+    auto container = item2->parentBoxContainer();
+    CHECK(container != root.get());
+
+    std::unordered_map<Item *, int> numEmissions;
+    std::unordered_map<Item *, GeometryChanges> changes;
+    std::vector<KDBindings::ScopedConnection> connections;
+    Item::List items = root->items_recursive();
+    items.push_back(container);
+    for (Item *item : items) {
+        connections.push_back(item->geometryChanged.connect([item, &numEmissions, &changes](Rect, GeometryChanges c) {
+            numEmissions[item]++;
+            changes[item] = c;
+        }));
+    }
+
+    // Inserting on the left moves the nested container, which in turn moves item2 and item3
+    Item *item4 = createItem();
+    root->insertItem(item4, Location_OnLeft);
+
+    for (const auto &it : numEmissions)
+        CHECK_EQ(it.second, 1);
+
+    CHECK(changes[container].testFlag(GeometryChange_X));
+    CHECK(changes[item2].testFlag(GeometryChange_AncestorMoved));
+    CHECK(changes[item3].testFlag(GeometryChange_AncestorMoved));
+    CHECK(!changes[item2].testFlag(GeometryChange_X));
+    CHECK(root->checkSanity());
+
+    KDDW_TEST_RETURN(true);
+}
+
 static const std::vector<KDDWTest> s_tests = {
     TEST(tst_createRoot),
     TEST(tst_insertOne),
@@ -2373,6 +2460,8 @@ static const std::vector<KDDWTest> s_tests = {
     TEST(tst_outermostNeighbor),
     TEST(tst_relativeToHidden),
     TEST(tst_spuriousResize),
+    TEST(tst_simulateDrop),
+    TEST(tst_coalescedGeometryChanges),
 };
 
 #include "tests_main.h"
@@ -110,6 +110,15 @@ struct EnsureTopLevelsDeleted
         Config::self().setMDIFlags(m_originalMDIFlags);
         Config::self().setSeparatorThickness(m_originalSeparatorThickness);
         Config::self().setLayoutSaverStrictMode(false);
+        Config::self().setFloatingWindowPoolSize(0);
+        Config::self().setSeparatorPoolSize(0);
+        Config::self().setLayoutTransitionDuration(0);
+        Config::self().setLayoutProfilingEnabled(false);
+        Config::self().setDeferredDeletionBudget(0);
+        Config::self().setSharedClassicIndicatorWindow(false);
+        Config::self().setDragMotionCompression(false);
+        Config::self().setDragMotionCappedAtRefreshRate(false);
+        Config::self().setDragHoverThreshold(0);
         InitialOption::s_defaultNeighbourSqueezeStrategy = NeighbourSqueezeStrategy::AllNeighbours;
     }
 